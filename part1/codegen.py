@@ -1,13 +1,21 @@
 """This file generates C++ source code for performing some computation over the
 elements of a std::vector.
 
-In particular, it generates three files:
+In particular, it generates five files:
 
 1. vectest_{num_elems}_runtime.cpp, which does this computation at runtime
 2. vectest_{num_elems}_constexpr.cpp, which does this computation possibly at
    compile time
 3. vectest_{num_elems}_consteval.cpp, which does this computation at compile
    time
+4. vectest_{num_elems}_arena.cpp, which does this computation at runtime over a
+   std::pmr::vector allocated from a static arena instead of the heap, and
+   reports allocation counts and timing against the default allocator. It
+   includes part2/my_arena.h, so compile it with `-I ../part2`.
+5. vectest_{num_elems}_mmap.cpp, which does this computation at runtime over
+   the binary data file vectest_{num_elems}.bin, also written by this script.
+   The file is memory-mapped and streamed a chunk at a time, so it can hold
+   far more elements than could ever be baked into source code.
 
 This script can be adapted for general usage by modifying the following:
 
@@ -15,18 +23,51 @@ This script can be adapted for general usage by modifying the following:
                             compute over.
 - functors_for_computation -> This string should contain C++ functors
                               corresponding to the computations you want to
-                              perform.
+                              perform. They take the vector as `const auto&`
+                              so that the arena variant can pass a
+                              std::pmr::vector, and the mmap variant can
+                              pass a std::span.
+- streamed_num_elems -> If set, the mmap variant's data file holds this many
+                        random elements instead of the ones returned by
+                        data_for_computation().
 
 Q: Why do we pre-generate this code?
 
 A: To write a constexpr or consteval function, we need to bake all the elements
-   used to populate the std::vector into the source code itself and explicitly
-   add them to the std::vector one by one.
+   used to populate the std::vector into the source code itself.
+
+Q: Why is the data emitted as a single `dataset` object?
+
+A: If the elements were added to the std::vector one by one inside
+   `doComputation`, every functor instantiation would have to re-parse and
+   re-evaluate the whole population sequence. Emitting the elements once as a
+   namespace-scope constexpr std::array means the compiler builds the data once
+   per translation unit, and each computation only copies it into a
+   std::vector.
+
+Q: What does the arena variant measure?
+
+A: Code collecting its input usually grows a std::vector one push_back at a
+   time, reallocating as it goes. The arena variant populates the vector that
+   way on every run and times population plus computation, once with the
+   default allocator and once with each arena mode: monotonic, which bump
+   allocates and is released between runs, and pooled, which reuses freed
+   blocks. With the arenas, none of those allocations reach the heap.
+
+Q: How does the mmap variant handle inputs larger than RAM?
+
+A: It maps a window of the data file at a time, runs the functor over the
+   window as a std::span, and unmaps it before moving on, so only one window
+   is ever resident. The per-window results are combined by running the
+   functor once more over them. This is only correct for functors where
+   computing over partial results gives the same answer as computing over the
+   whole input, as it does for sums and (modular) products.
 """
 
 
+from array import array
 from random import randint
-from typing import List
+from typing import Iterable, List, Optional
 
 
 ############### MAKE MODIFICATIONS BELOW THIS LINE ###############
@@ -53,6 +94,14 @@ def data_for_computation() -> List[int]:
     return l
 
 
+# The number of elements in the mmap variant's data file. If None, the file
+# holds the elements returned by data_for_computation(). Otherwise it holds
+# this many random numbers, generated a block at a time so that 10^8-10^9
+# elements never need to be in memory at once. The file takes 8 bytes per
+# element.
+streamed_num_elems: Optional[int] = None
+
+
 # This string should contain the functors that you want to use for computation.
 # These must be valid C++ functors, else compilation of the C++ code will fail.
 # The functors will be written out as part of the generated C++ source code.
@@ -64,7 +113,7 @@ concept Arithmetic = std::is_arithmetic_v<T>;
 // Functor that sums the elements of a vector.
 template <Arithmetic T>
 struct SimpleSum {
-    constexpr T operator()(const std::vector<T>& v) {
+    constexpr T operator()(const auto& v) {
         return std::accumulate(v.begin(), v.end(), static_cast<T>(0));
     }
 };
@@ -72,7 +121,7 @@ struct SimpleSum {
 // Functor that multiplies the elements of a vector (while taking mod 1e9).
 template <Arithmetic T>
 struct SimpleProd {
-    constexpr T operator()(const std::vector<T>& v) {
+    constexpr T operator()(const auto& v) {
         return std::accumulate(v.begin(), v.end(), static_cast<T>(1),
             [](const T& accum, const T& elem) -> T {
                 return (accum * elem) % static_cast<T>(1e9);
@@ -89,6 +138,7 @@ struct SimpleProd {
 boilerplate_head = """// This file was auto-generated by `codegen.py`.
 // Do not modify it manually unless there is good reason to.
 
+#include <array>
 #include <chrono>
 #include <concepts>
 #include <iostream>
@@ -96,7 +146,7 @@ boilerplate_head = """// This file was auto-generated by `codegen.py`.
 #include <string_view>
 #include <type_traits>
 #include <vector>
-
+{includes}
 // Checks that some functor Func can be invoked at compile time on a std::vector
 // containing elements of type T.
 //
@@ -108,6 +158,14 @@ concept CompileTimeInvocable = requires (Func f) {{
 }};
 {functors}"""
 
+dataset_contents = """
+// The elements to compute over. This is the only place they appear in the
+// source code, and is shared by every computation in this file.
+template <typename T>
+constexpr std::array<T, {num_elems}> dataset = {{{{
+{dataset}}}}};
+"""
+
 boilerplate_tail = """
 int main() {{
     using namespace std::literals;
@@ -120,8 +178,8 @@ int main() {{
 
 # The code below does the computation in a constexpr or consteval function.
 compiletime_contents = """
-// Populates a std::vector, then performs some computation over its elements.
-// This function is executed {description}.
+// Copies `dataset` into a std::vector, then performs some computation over its
+// elements. This function is executed {description}.
 //
 // To obtain statistics on runtime, time how long it takes for a call to this
 // function to be completed. We don't do the timing inside this function,
@@ -132,11 +190,7 @@ compiletime_contents = """
 template <typename Func, typename T>
 requires CompileTimeInvocable<Func, T>
 {specifier} T doComputation() {{
-    // The repeated statements are ugly, but we need to explicitly add each
-    // individual element rather than using a std::random_device and a loop so
-    // that the function can be executed at compile time.
-    std::vector<T> v;
-{populate_vector}
+    std::vector<T> v(dataset<T>.begin(), dataset<T>.end());
     return Func()(v);
 }}
 
@@ -160,17 +214,10 @@ void runTestCase(int numRuns, std::string_view testName) {{
 # std::vector using a separate function, so that we don't end up including the
 # time taken to populate the std::vector in our measurements.
 runtime_contents = """
-// Populates a std::vector with the same elements used to populate the
-// std::vector in the compile-time code.
-//
-// The repeated statements are ugly, but we do this instead of using a
-// std::random_device and a loop so that we can populate the std::vector with
-// the same elements used in the compile-time code.
+// Populates a std::vector with the same elements used in the compile-time code.
 template <typename T>
 std::vector<T> populateVec() {{
-    std::vector<T> v;
-{populate_vector}
-    return v;
+    return std::vector<T>(dataset<T>.begin(), dataset<T>.end());
 }}
 
 // Performs some computation over the elements of a pre-populated std::vector.
@@ -201,15 +248,210 @@ void runTestCase(int numRuns, std::string_view testName) {{
 }}
 """
 
+# The code below does the computation in a runtime function over a
+# std::pmr::vector whose memory comes from a static arena. Unlike the runtime
+# variant, population is part of every run, since the allocations it makes are
+# what we want to measure.
+arena_contents = """
+// Arenas sized for a std::pmr::vector growing to {num_elems} elements one
+// push_back at a time. They live in static storage, not on the heap.
+template <typename T>
+VecArena<T, {num_elems}, ArenaMode::monotonic> monotonicArena;
+
+template <typename T>
+VecArena<T, {num_elems}, ArenaMode::pooled> pooledArena;
+
+// Populates a std::pmr::vector with the same elements used in the compile-time
+// code, one push_back at a time, allocating from `resource`.
+template <typename T>
+std::pmr::vector<T> populateVec(std::pmr::memory_resource* resource) {{
+    std::pmr::vector<T> v(resource);
+    for (const T& elem : dataset<T>)
+        v.push_back(elem);
+    return v;
+}}
+
+// Populates a std::pmr::vector from `resource`, then performs some computation
+// over its elements. This function is executed at runtime.
+//
+// @tparam Func the computation to be executed
+// @tparam T the type of elements in the std::pmr::vector
+template <typename Func, typename T>
+requires CompileTimeInvocable<Func, T>
+T doComputation(std::pmr::memory_resource* resource) {{
+    std::pmr::vector<T> v = populateVec<T>(resource);
+    return Func()(v);
+}}
+
+// Times one call to `doComputation` allocating from `resource`, and prints the
+// result, the number of allocations made and the timing.
+template <typename Func, typename T>
+void runWithResource(std::string_view testName, std::string_view resourceName,
+                     std::pmr::memory_resource* resource) {{
+    CountingResource counted(resource);
+    auto start = std::chrono::high_resolution_clock::now();
+    T res = doComputation<Func, T>(&counted);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << testName << " (" << resourceName << ") result: " << res << "\\n";
+    std::cout << testName << " (" << resourceName << ") allocations: " << counted.allocations() << "\\n";
+    std::cout << testName << " (" << resourceName << ") timing: " << (end-start).count() << " ns\\n";
+}}
+
+// Wrapper over `runWithResource` that executes the test `numRuns` number of
+// times with the default allocator and with each arena.
+template <typename Func, typename T>
+void runTestCase(int numRuns, std::string_view testName) {{
+    using namespace std::literals;
+
+    for (int i = 0; i < numRuns; ++i) {{
+        runWithResource<Func, T>(testName, "default"sv, std::pmr::new_delete_resource());
+        runWithResource<Func, T>(testName, "monotonic arena"sv, &monotonicArena<T>);
+        monotonicArena<T>.release();
+        runWithResource<Func, T>(testName, "pooled arena"sv, &pooledArena<T>);
+    }}
+    std::cout << "\\n";
+}}
+"""
+
+arena_includes = """
+#include "my_arena.h"
+"""
+
+# The code below does the computation at runtime over a data file that is
+# memory-mapped a window at a time, so the dataset never appears in the source
+# code and its size is limited only by the disk.
+mmap_contents = """
+// Maps a binary file of T a window at a time. Each window is at most
+// `windowBytes` long, and is unmapped before the next one is mapped, so the
+// file can be larger than memory.
+template <typename T>
+class MappedFile {{
+public:
+    MappedFile(const char* path, std::size_t windowBytes) {{
+        fd = open(path, O_RDONLY);
+        if (fd == -1)
+            throw std::system_error(errno, std::generic_category(), path);
+        struct stat st;
+        if (fstat(fd, &st) == -1) {{
+            close(fd);
+            throw std::system_error(errno, std::generic_category(), path);
+        }}
+        fileBytes = static_cast<std::size_t>(st.st_size);
+        // Windows must start on a page boundary and hold whole elements
+        std::size_t unit = std::lcm(static_cast<std::size_t>(sysconf(_SC_PAGESIZE)), sizeof(T));
+        this->windowBytes = std::max(unit, windowBytes / unit * unit);
+    }}
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {{
+        close(fd);
+    }}
+
+    std::size_t size() const {{
+        return fileBytes / sizeof(T);
+    }}
+
+    // Calls `f` with a std::span over each window of the file in order. The
+    // span is only valid during the call.
+    template <typename F>
+    void forEachWindow(F f) const {{
+        for (std::size_t offset = 0; offset < fileBytes; offset += windowBytes) {{
+            std::size_t length = std::min(windowBytes, fileBytes - offset);
+            void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+            if (p == MAP_FAILED)
+                throw std::system_error(errno, std::generic_category(), "mmap");
+            madvise(p, length, MADV_SEQUENTIAL);
+            f(std::span<const T>(static_cast<const T*>(p), length / sizeof(T)));
+            munmap(p, length);
+        }}
+    }}
+
+private:
+    int fd;
+    std::size_t fileBytes;
+    std::size_t windowBytes;
+}};
+
+// Performs some computation over every window of `file`, then over the
+// per-window results. This function is executed at runtime.
+//
+// @tparam Func the computation to be executed
+// @tparam T the type of elements in the file
+template <typename Func, typename T>
+requires CompileTimeInvocable<Func, T>
+T doComputation(const MappedFile<T>& file) {{
+    std::vector<T> partials;
+    file.forEachWindow([&](std::span<const T> window) {{
+        partials.push_back(Func()(window));
+    }});
+    return Func()(std::span<const T>(partials));
+}}
+
+// Wrapper over `doComputation` that:
+// (1) executes the test `numRuns` number of times
+// (2) times each function call and prints the relevant results
+//
+// Each run maps the file afresh, so the timing includes reading it. The first
+// run may read from disk, later ones from the page cache if the file fits.
+template <typename Func, typename T>
+void runTestCase(int numRuns, std::string_view testName, const char* path, std::size_t windowBytes) {{
+    MappedFile<T> file(path, windowBytes);
+    std::cout << testName << " elements: " << file.size() << "\\n";
+    for (int i = 0; i < numRuns; ++i) {{
+        auto start = std::chrono::high_resolution_clock::now();
+        T res = doComputation<Func, T>(file);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << testName << " result: " << res << "\\n";
+        std::cout << testName << " timing: " << (end-start).count() << " ns\\n";
+    }}
+    std::cout << "\\n";
+}}
+"""
+
+mmap_includes = """
+#include <algorithm>
+#include <cerrno>
+#include <span>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+"""
+
+# The mmap variant reads the path of the data file and the window size in MiB
+# from the command line, defaulting to the file written alongside it.
+mmap_tail = """
+// Usage: {filename} [data file] [window MiB]
+int main(int argc, char** argv) {{
+    using namespace std::literals;
+
+    const char* path = argc > 1 ? argv[1] : "{data_filename}";
+    std::size_t windowBytes = (argc > 2 ? std::stoull(argv[2]) : 64) << 20;
+
+    int numRuns = {num_runs};
+    runTestCase<SimpleSum<long long>, long long>(numRuns, "SimpleSum"sv, path, windowBytes);
+    runTestCase<SimpleProd<long long>, long long>(numRuns, "SimpleProd"sv, path, windowBytes);
+}}
+"""
+
 
 def generate_filename(test_type: str, num_elems: int) -> str:
     return f"vectest_{num_elems}_{test_type}.cpp"
 
 
-def generate_populationcode(l: List[int]) -> str:
+def generate_data_filename(num_elems: int) -> str:
+    return f"vectest_{num_elems}.bin"
+
+
+def generate_dataset(l: List[int]) -> str:
     s = ""
     for elem in l:
-        s += f"    v.emplace_back({elem});\n"
+        s += f"    {elem},\n"
     return s
 
 
@@ -223,12 +465,16 @@ def generate_compiletime_code(
     ) else "possibly at compile time"
 
     filecontents = boilerplate_head.format(
+        includes="",
         functors=functors_for_computation,
     )
+    filecontents += dataset_contents.format(
+        num_elems=len(l),
+        dataset=generate_dataset(l),
+    )
     filecontents += compiletime_contents.format(
         description=description,
         specifier=specifier,
-        populate_vector=generate_populationcode(l),
     )
     filecontents += boilerplate_tail.format(num_runs=num_runs)
     with open(filename, "w") as f:
@@ -239,16 +485,77 @@ def generate_runtime_code(l: List[int], num_runs: int) -> None:
     filename = generate_filename("runtime", len(l))
 
     filecontents = boilerplate_head.format(
+        includes="",
+        functors=functors_for_computation,
+    )
+    filecontents += dataset_contents.format(
+        num_elems=len(l),
+        dataset=generate_dataset(l),
+    )
+    filecontents += runtime_contents.format()
+    filecontents += boilerplate_tail.format(num_runs=num_runs)
+    with open(filename, "w") as f:
+        f.write(filecontents)
+
+
+def generate_arena_code(l: List[int], num_runs: int) -> None:
+    filename = generate_filename("arena", len(l))
+
+    filecontents = boilerplate_head.format(
+        includes=arena_includes,
         functors=functors_for_computation,
     )
-    filecontents += runtime_contents.format(
-        populate_vector=generate_populationcode(l),
+    filecontents += dataset_contents.format(
+        num_elems=len(l),
+        dataset=generate_dataset(l),
     )
+    filecontents += arena_contents.format(num_elems=len(l))
     filecontents += boilerplate_tail.format(num_runs=num_runs)
     with open(filename, "w") as f:
         f.write(filecontents)
 
 
+# Yields `num_elems` random numbers in blocks, drawn like the ones in
+# data_for_computation().
+def generate_streamed_data(num_elems: int) -> Iterable[List[int]]:
+    block_elems = 1 << 20
+    for start in range(0, num_elems, block_elems):
+        count = min(block_elems, num_elems - start)
+        yield [randint(-1e9, 1e9) for _ in range(count)]
+
+
+# Writes the mmap variant's data file as native-endian 64-bit integers, which
+# is how the generated code reads it as `long long`. Returns the number of
+# elements written.
+def generate_data_file(l: List[int]) -> int:
+    blocks = [l] if streamed_num_elems is None else (
+        generate_streamed_data(streamed_num_elems)
+    )
+    num_elems = len(l) if streamed_num_elems is None else streamed_num_elems
+    with open(generate_data_filename(num_elems), "wb") as f:
+        for block in blocks:
+            array("q", block).tofile(f)
+    return num_elems
+
+
+def generate_mmap_code(l: List[int], num_runs: int) -> None:
+    num_elems = generate_data_file(l)
+    filename = generate_filename("mmap", num_elems)
+
+    filecontents = boilerplate_head.format(
+        includes=mmap_includes,
+        functors=functors_for_computation,
+    )
+    filecontents += mmap_contents.format()
+    filecontents += mmap_tail.format(
+        filename=filename,
+        data_filename=generate_data_filename(num_elems),
+        num_runs=num_runs,
+    )
+    with open(filename, "w") as f:
+        f.write(filecontents)
+
+
 def main() -> None:
     # Each test is run `num_runs` number of times.
     num_runs = 1
@@ -258,10 +565,16 @@ def main() -> None:
     """Each file roughly follows the following structure:
 
     <boilerplate_head>
-    <compiletime_body> OR <runtime_body>
+    <dataset_contents>
+    <compiletime_body> OR <runtime_body> OR <arena_body>
     <boilerplate_tail>
+
+    except the mmap variant, which has no dataset, reads its elements from
+    vectest_{num_elems}.bin and has a main() taking command-line arguments.
     """
     generate_runtime_code(l, num_runs)
+    generate_arena_code(l, num_runs)
+    generate_mmap_code(l, num_runs)
     generate_compiletime_code(l, num_runs, "constexpr")
     generate_compiletime_code(l, num_runs, "consteval")
 
@@ -0,0 +1,126 @@
+/************************************************************
+ * This is a sample file generated by `codegen.py`, where   *
+ * the number of elements is 1 and the number of runs is 1. *
+ ************************************************************/
+
+// This file was auto-generated by `codegen.py`.
+// Do not modify it manually unless there is good reason to.
+
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <iostream>
+#include <numeric>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "my_arena.h"
+
+// Checks that some functor Func can be invoked at compile time on a std::vector
+// containing elements of type T.
+//
+// Usage of std::bool_constant was inspired by stackoverflow question 63326542.
+template <typename Func, typename T>
+concept CompileTimeInvocable = requires (Func f) {
+    { std::bool_constant<(Func()(std::vector<T>{}), true)>() };
+    { Func()(std::vector<T>{}) } -> std::same_as<T>;
+};
+
+// Wrapper around the std::is_arithmetic type trait.
+template <typename T>
+concept Arithmetic = std::is_arithmetic_v<T>;
+
+// Functor that sums the elements of a vector.
+template <Arithmetic T>
+struct SimpleSum {
+    constexpr T operator()(const auto& v) {
+        return std::accumulate(v.begin(), v.end(), static_cast<T>(0));
+    }
+};
+
+// Functor that multiplies the elements of a vector (while taking mod 1e9).
+template <Arithmetic T>
+struct SimpleProd {
+    constexpr T operator()(const auto& v) {
+        return std::accumulate(v.begin(), v.end(), static_cast<T>(1),
+            [](const T& accum, const T& elem) -> T {
+                return (accum * elem) % static_cast<T>(1e9);
+            }
+        );
+    }
+};
+
+// The elements to compute over. This is the only place they appear in the
+// source code, and is shared by every computation in this file.
+template <typename T>
+constexpr std::array<T, 1> dataset = {{
+    -861940221,
+}};
+
+// Arenas sized for a std::pmr::vector growing to 1 elements one
+// push_back at a time. They live in static storage, not on the heap.
+template <typename T>
+VecArena<T, 1, ArenaMode::monotonic> monotonicArena;
+
+template <typename T>
+VecArena<T, 1, ArenaMode::pooled> pooledArena;
+
+// Populates a std::pmr::vector with the same elements used in the compile-time
+// code, one push_back at a time, allocating from `resource`.
+template <typename T>
+std::pmr::vector<T> populateVec(std::pmr::memory_resource* resource) {
+    std::pmr::vector<T> v(resource);
+    for (const T& elem : dataset<T>)
+        v.push_back(elem);
+    return v;
+}
+
+// Populates a std::pmr::vector from `resource`, then performs some computation
+// over its elements. This function is executed at runtime.
+//
+// @tparam Func the computation to be executed
+// @tparam T the type of elements in the std::pmr::vector
+template <typename Func, typename T>
+requires CompileTimeInvocable<Func, T>
+T doComputation(std::pmr::memory_resource* resource) {
+    std::pmr::vector<T> v = populateVec<T>(resource);
+    return Func()(v);
+}
+
+// Times one call to `doComputation` allocating from `resource`, and prints the
+// result, the number of allocations made and the timing.
+template <typename Func, typename T>
+void runWithResource(std::string_view testName, std::string_view resourceName,
+                     std::pmr::memory_resource* resource) {
+    CountingResource counted(resource);
+    auto start = std::chrono::high_resolution_clock::now();
+    T res = doComputation<Func, T>(&counted);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << testName << " (" << resourceName << ") result: " << res << "\n";
+    std::cout << testName << " (" << resourceName << ") allocations: " << counted.allocations() << "\n";
+    std::cout << testName << " (" << resourceName << ") timing: " << (end-start).count() << " ns\n";
+}
+
+// Wrapper over `runWithResource` that executes the test `numRuns` number of
+// times with the default allocator and with each arena.
+template <typename Func, typename T>
+void runTestCase(int numRuns, std::string_view testName) {
+    using namespace std::literals;
+
+    for (int i = 0; i < numRuns; ++i) {
+        runWithResource<Func, T>(testName, "default"sv, std::pmr::new_delete_resource());
+        runWithResource<Func, T>(testName, "monotonic arena"sv, &monotonicArena<T>);
+        monotonicArena<T>.release();
+        runWithResource<Func, T>(testName, "pooled arena"sv, &pooledArena<T>);
+    }
+    std::cout << "\n";
+}
+
+int main() {
+    using namespace std::literals;
+
+    int numRuns = 1;
+    runTestCase<SimpleSum<long long>, long long>(numRuns, "SimpleSum"sv);
+    runTestCase<SimpleProd<long long>, long long>(numRuns, "SimpleProd"sv);
+}
@@ -6,6 +6,7 @@
 // This file was auto-generated by `codegen.py`.
 // Do not modify it manually unless there is good reason to.
 
+#include <array>
 #include <chrono>
 #include <concepts>
 #include <iostream>
@@ -31,7 +32,7 @@ concept Arithmetic = std::is_arithmetic_v<T>;
 // Functor that sums the elements of a vector.
 template <Arithmetic T>
 struct SimpleSum {
-    constexpr T operator()(const std::vector<T>& v) {
+    constexpr T operator()(const auto& v) {
         return std::accumulate(v.begin(), v.end(), static_cast<T>(0));
     }
 };
@@ -39,7 +40,7 @@ struct SimpleSum {
 // Functor that multiplies the elements of a vector (while taking mod 1e9).
 template <Arithmetic T>
 struct SimpleProd {
-    constexpr T operator()(const std::vector<T>& v) {
+    constexpr T operator()(const auto& v) {
         return std::accumulate(v.begin(), v.end(), static_cast<T>(1),
             [](const T& accum, const T& elem) -> T {
                 return (accum * elem) % static_cast<T>(1e9);
@@ -48,8 +49,15 @@ struct SimpleProd {
     }
 };
 
-// Populates a std::vector, then performs some computation over its elements.
-// This function is executed at compile time.
+// The elements to compute over. This is the only place they appear in the
+// source code, and is shared by every computation in this file.
+template <typename T>
+constexpr std::array<T, 1> dataset = {{
+    -861940221,
+}};
+
+// Copies `dataset` into a std::vector, then performs some computation over its
+// elements. This function is executed at compile time.
 //
 // To obtain statistics on runtime, time how long it takes for a call to this
 // function to be completed. We don't do the timing inside this function,
@@ -60,13 +68,7 @@ struct SimpleProd {
 template <typename Func, typename T>
 requires CompileTimeInvocable<Func, T>
 consteval  T doComputation() {
-    // The repeated statements are ugly, but we need to explicitly add each
-    // individual element rather than using a std::random_device and a loop so
-    // that the function can be executed at compile time.
-    std::vector<T> v;
-    v.emplace_back(-861940221);
-
-
+    std::vector<T> v(dataset<T>.begin(), dataset<T>.end());
     return Func()(v);
 }
 
@@ -0,0 +1,161 @@
+/************************************************************
+ * This is a sample file generated by `codegen.py`, where   *
+ * the number of elements is 1 and the number of runs is 1. *
+ ************************************************************/
+
+// This file was auto-generated by `codegen.py`.
+// Do not modify it manually unless there is good reason to.
+
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <iostream>
+#include <numeric>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <algorithm>
+#include <cerrno>
+#include <span>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Checks that some functor Func can be invoked at compile time on a std::vector
+// containing elements of type T.
+//
+// Usage of std::bool_constant was inspired by stackoverflow question 63326542.
+template <typename Func, typename T>
+concept CompileTimeInvocable = requires (Func f) {
+    { std::bool_constant<(Func()(std::vector<T>{}), true)>() };
+    { Func()(std::vector<T>{}) } -> std::same_as<T>;
+};
+
+// Wrapper around the std::is_arithmetic type trait.
+template <typename T>
+concept Arithmetic = std::is_arithmetic_v<T>;
+
+// Functor that sums the elements of a vector.
+template <Arithmetic T>
+struct SimpleSum {
+    constexpr T operator()(const auto& v) {
+        return std::accumulate(v.begin(), v.end(), static_cast<T>(0));
+    }
+};
+
+// Functor that multiplies the elements of a vector (while taking mod 1e9).
+template <Arithmetic T>
+struct SimpleProd {
+    constexpr T operator()(const auto& v) {
+        return std::accumulate(v.begin(), v.end(), static_cast<T>(1),
+            [](const T& accum, const T& elem) -> T {
+                return (accum * elem) % static_cast<T>(1e9);
+            }
+        );
+    }
+};
+
+// Maps a binary file of T a window at a time. Each window is at most
+// `windowBytes` long, and is unmapped before the next one is mapped, so the
+// file can be larger than memory.
+template <typename T>
+class MappedFile {
+public:
+    MappedFile(const char* path, std::size_t windowBytes) {
+        fd = open(path, O_RDONLY);
+        if (fd == -1)
+            throw std::system_error(errno, std::generic_category(), path);
+        struct stat st;
+        if (fstat(fd, &st) == -1) {
+            close(fd);
+            throw std::system_error(errno, std::generic_category(), path);
+        }
+        fileBytes = static_cast<std::size_t>(st.st_size);
+        // Windows must start on a page boundary and hold whole elements
+        std::size_t unit = std::lcm(static_cast<std::size_t>(sysconf(_SC_PAGESIZE)), sizeof(T));
+        this->windowBytes = std::max(unit, windowBytes / unit * unit);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+        close(fd);
+    }
+
+    std::size_t size() const {
+        return fileBytes / sizeof(T);
+    }
+
+    // Calls `f` with a std::span over each window of the file in order. The
+    // span is only valid during the call.
+    template <typename F>
+    void forEachWindow(F f) const {
+        for (std::size_t offset = 0; offset < fileBytes; offset += windowBytes) {
+            std::size_t length = std::min(windowBytes, fileBytes - offset);
+            void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+            if (p == MAP_FAILED)
+                throw std::system_error(errno, std::generic_category(), "mmap");
+            madvise(p, length, MADV_SEQUENTIAL);
+            f(std::span<const T>(static_cast<const T*>(p), length / sizeof(T)));
+            munmap(p, length);
+        }
+    }
+
+private:
+    int fd;
+    std::size_t fileBytes;
+    std::size_t windowBytes;
+};
+
+// Performs some computation over every window of `file`, then over the
+// per-window results. This function is executed at runtime.
+//
+// @tparam Func the computation to be executed
+// @tparam T the type of elements in the file
+template <typename Func, typename T>
+requires CompileTimeInvocable<Func, T>
+T doComputation(const MappedFile<T>& file) {
+    std::vector<T> partials;
+    file.forEachWindow([&](std::span<const T> window) {
+        partials.push_back(Func()(window));
+    });
+    return Func()(std::span<const T>(partials));
+}
+
+// Wrapper over `doComputation` that:
+// (1) executes the test `numRuns` number of times
+// (2) times each function call and prints the relevant results
+//
+// Each run maps the file afresh, so the timing includes reading it. The first
+// run may read from disk, later ones from the page cache if the file fits.
+template <typename Func, typename T>
+void runTestCase(int numRuns, std::string_view testName, const char* path, std::size_t windowBytes) {
+    MappedFile<T> file(path, windowBytes);
+    std::cout << testName << " elements: " << file.size() << "\n";
+    for (int i = 0; i < numRuns; ++i) {
+        auto start = std::chrono::high_resolution_clock::now();
+        T res = doComputation<Func, T>(file);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << testName << " result: " << res << "\n";
+        std::cout << testName << " timing: " << (end-start).count() << " ns\n";
+    }
+    std::cout << "\n";
+}
+
+// Usage: vectest_1_mmap.cpp [data file] [window MiB]
+int main(int argc, char** argv) {
+    using namespace std::literals;
+
+    const char* path = argc > 1 ? argv[1] : "vectest_1.bin";
+    std::size_t windowBytes = (argc > 2 ? std::stoull(argv[2]) : 64) << 20;
+
+    int numRuns = 1;
+    runTestCase<SimpleSum<long long>, long long>(numRuns, "SimpleSum"sv, path, windowBytes);
+    runTestCase<SimpleProd<long long>, long long>(numRuns, "SimpleProd"sv, path, windowBytes);
+}
@@ -6,6 +6,7 @@
 // This file was auto-generated by `codegen.py`.
 // Do not modify it manually unless there is good reason to.
 
+#include <array>
 #include <chrono>
 #include <concepts>
 #include <iostream>
@@ -31,7 +32,7 @@ concept Arithmetic = std::is_arithmetic_v<T>;
 // Functor that sums the elements of a vector.
 template <Arithmetic T>
 struct SimpleSum {
-    constexpr T operator()(const std::vector<T>& v) {
+    constexpr T operator()(const auto& v) {
         return std::accumulate(v.begin(), v.end(), static_cast<T>(0));
     }
 };
@@ -39,7 +40,7 @@ struct SimpleSum {
 // Functor that multiplies the elements of a vector (while taking mod 1e9).
 template <Arithmetic T>
 struct SimpleProd {
-    constexpr T operator()(const std::vector<T>& v) {
+    constexpr T operator()(const auto& v) {
         return std::accumulate(v.begin(), v.end(), static_cast<T>(1),
             [](const T& accum, const T& elem) -> T {
                 return (accum * elem) % static_cast<T>(1e9);
@@ -48,18 +49,17 @@ struct SimpleProd {
     }
 };
 
-// Populates a std::vector with the same elements used to populate the
-// std::vector in the compile-time code.
-//
-// The repeated statements are ugly, but we do this instead of using a
-// std::random_device and a loop so that we can populate the std::vector with
-// the same elements used in the compile-time code.
+// The elements to compute over. This is the only place they appear in the
+// source code, and is shared by every computation in this file.
 template <typename T>
-std::vector<T> populateVec() {
-    std::vector<T> v;
-    v.emplace_back(-861940221);
+constexpr std::array<T, 1> dataset = {{
+    -861940221,
+}};
 
-    return v;
+// Populates a std::vector with the same elements used in the compile-time code.
+template <typename T>
+std::vector<T> populateVec() {
+    return std::vector<T>(dataset<T>.begin(), dataset<T>.end());
 }
 
 // Performs some computation over the elements of a pre-populated std::vector.
@@ -0,0 +1,1309 @@
+#include "my_vector.h"
+#include "my_bitvec.h"
+#include "my_concurrent_vector.h"
+#include "my_gap_vector.h"
+#include "my_matrix.h"
+#include "my_priority_queue.h"
+#include "vec_algorithms.h"
+#include "vec_expr.h"
+#include "vec_range_query.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#if __has_include(<inplace_vector>)
+#include <inplace_vector>
+#endif
+
+// Microbenchmarks of MyVec against std::vector and its other peers.
+//
+//     g++ -std=c++20 -O2 -pthread bench.cpp -o bench
+//     ./bench                 # every element type and capacity
+//     ./bench string          # only the tables whose title contains "string"
+//     ./bench --constexpr     # cost of the same operations in constant evaluation
+//     ./bench --concurrent    # ConcurrentMyVec under contention, see below
+//     ./bench --gap           # MyGapVec on cursor-local edits, see below
+//     ./bench --expr          # fused expression templates, see below
+//     ./bench --heap          # MyPriorityQueue at runtime and compile time, see below
+//     ./bench --matrix        # MyMatrix multiply and transpose, see below
+//     ./bench --range         # range-query indexes against scanning, see below
+//     ./bench --sort          # sort() against std::sort at runtime and compile time, see below
+//     ./bench --sieve         # compile-time prime sieves on MyVec<bool> and MyBitVec, see below
+//
+// Each table is one element type at one capacity N. Rows are operations and
+// columns containers. Cells are the best of several trials, in ns per call
+// (construct, copy, swap, compare) or per element (the rest). Repeated
+// constructs and copies into the same storage include destroying the previous
+// object. std::array has no size, so it only takes part in the operations that
+// do not change one.
+//
+// Growing operations start from an empty container and run until it holds N
+// elements; erase_* start from a full one and run until it is empty. Setting
+// up and tearing down the container is not timed.
+
+namespace {
+
+struct Pod64 {
+    std::array<std::uint64_t, 8> words;
+
+    friend constexpr bool operator==(const Pod64&, const Pod64&) = default;
+};
+
+enum Op {
+    construct, push_back, insert_front, insert_middle, insert_back,
+    erase_front, erase_middle, erase_back, copy, swap, compare, iterate,
+    op_count,
+};
+
+constexpr const char* op_names[op_count] = {
+    "construct", "push_back", "insert_front", "insert_middle", "insert_back",
+    "erase_front", "erase_middle", "erase_back", "copy", "swap", "compare", "iterate",
+};
+
+constexpr bool per_element(Op op) { return op != construct && op != copy && op != swap && op != compare; }
+
+constexpr bool changes_size(Op op) { return op != construct && op < copy; }
+
+template<class T>
+T make_value(std::size_t i) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        // Longer than any small-string buffer, so every copy allocates
+        std::string s = "element-" + std::to_string(i);
+        s.resize(32, '.');
+        return s;
+    } else if constexpr (std::is_same_v<T, Pod64>) {
+        Pod64 p;
+        for (std::size_t k = 0; k < p.words.size(); ++k)
+            p.words[k] = i + k;
+        return p;
+    } else {
+        return T(i);
+    }
+}
+
+template<class T>
+std::size_t key(const T& value) {
+    if constexpr (std::is_same_v<T, std::string>)
+        return value.size();
+    else if constexpr (std::is_same_v<T, Pod64>)
+        return value.words[0];
+    else
+        return std::size_t(value);
+}
+
+// Keeps the compiler from discarding work whose result is otherwise unused
+template<class T>
+void keep(const T& value) { asm volatile("" : : "g"(&value) : "memory"); }
+
+// Heap storage for one container, constructed and destroyed explicitly so that
+// setup and teardown stay outside the timed region. MyVec<Pod64, 4096> is
+// 256 KB, too large for the stack.
+template<class C>
+class Slot {
+public:
+    Slot() : storage(std::make_unique<Storage>()) {}
+    Slot(const Slot&) = delete;
+    ~Slot() { reset(); }
+
+    template<class... Args>
+    C& emplace(Args&&... args) {
+        reset();
+        return *(object = std::construct_at(reinterpret_cast<C*>(storage->bytes), std::forward<Args>(args)...));
+    }
+
+    C& operator*() { return *object; }
+
+    void reset() {
+        if (object)
+            std::destroy_at(object);
+        object = nullptr;
+    }
+
+private:
+    struct Storage {
+        alignas(C) std::byte bytes[sizeof(C)];
+    };
+
+    std::unique_ptr<Storage> storage;
+    C* object = nullptr;
+};
+
+// The containers compared. Each says how to make an empty one ready for N
+// elements and a full one.
+template<class T, std::size_t N>
+struct MyVecKind {
+    using type = MyVec<T, N>;
+    static constexpr bool sized = true;
+    static type& make_empty(Slot<type>& s) { return s.emplace(); }
+    static type& make_full(Slot<type>& s, const T& value) { return s.emplace(N, value); }
+};
+
+template<class T, std::size_t N>
+struct VectorKind {
+    using type = std::vector<T>;
+    static constexpr bool sized = true;
+    static type& make_empty(Slot<type>& s) { return s.emplace(); }
+    static type& make_full(Slot<type>& s, const T& value) { return s.emplace(N, value); }
+};
+
+template<class T, std::size_t N>
+struct ReservedVectorKind {
+    using type = std::vector<T>;
+    static constexpr bool sized = true;
+    static type& make_empty(Slot<type>& s) {
+        type& v = s.emplace();
+        v.reserve(N);
+        return v;
+    }
+    static type& make_full(Slot<type>& s, const T& value) {
+        type& v = make_empty(s);
+        v.assign(N, value);
+        return v;
+    }
+};
+
+template<class T, std::size_t N>
+struct ArrayKind {
+    using type = std::array<T, N>;
+    static constexpr bool sized = false;
+    static type& make_empty(Slot<type>& s) { return s.emplace(); }
+    static type& make_full(Slot<type>& s, const T& value) {
+        type& a = s.emplace();
+        a.fill(value);
+        return a;
+    }
+};
+
+#ifdef __cpp_lib_inplace_vector
+template<class T, std::size_t N>
+struct InplaceVectorKind {
+    using type = std::inplace_vector<T, N>;
+    static constexpr bool sized = true;
+    static type& make_empty(Slot<type>& s) { return s.emplace(); }
+    static type& make_full(Slot<type>& s, const T& value) { return s.emplace(N, value); }
+};
+#endif
+
+constexpr const char* column_names[] = {
+    "MyVec", "std::vector", "reserved", "std::array",
+#ifdef __cpp_lib_inplace_vector
+    "inplace",
+#endif
+};
+
+constexpr std::size_t column_count = std::size(column_names);
+
+using clock = std::chrono::steady_clock;
+
+constexpr int trials = 5;
+constexpr double trial_ns = 2e6;
+
+double elapsed_ns(clock::time_point from, clock::time_point to) {
+    return std::chrono::duration<double, std::nano>(to - from).count();
+}
+
+double clock_overhead_ns = 0;
+
+// Best over the trials of the mean time of body(), less the cost of reading
+// the clock, divided by per. Every trial repeats setup, body and teardown for
+// about trial_ns.
+template<class Setup, class Body, class Teardown>
+double measure(std::size_t per, Setup setup, Body body, Teardown teardown) {
+    double best = std::numeric_limits<double>::infinity();
+    for (int trial = 0; trial < trials; ++trial) {
+        double total = 0;
+        std::size_t reps = 0;
+        clock::time_point start = clock::now();
+        do {
+            setup();
+            clock::time_point t0 = clock::now();
+            body();
+            clock::time_point t1 = clock::now();
+            teardown();
+            total += elapsed_ns(t0, t1) - clock_overhead_ns;
+            ++reps;
+        } while (elapsed_ns(start, clock::now()) < trial_ns);
+        best = std::min(best, total / reps / per);
+    }
+    return std::max(best, 0.0);
+}
+
+void calibrate_clock() {
+    clock_overhead_ns = 0;
+    clock_overhead_ns = measure(1, [] {}, [] {}, [] {});
+}
+
+using Row = std::array<double, column_count>;
+using Table = std::array<Row, op_count>;
+
+template<class Kind, class T, std::size_t N>
+void bench_container(Table& table, std::size_t column) {
+    using C = typename Kind::type;
+    std::vector<T> values;
+    for (std::size_t i = 0; i < N; ++i)
+        values.push_back(make_value<T>(i));
+
+    Slot<C> slot, a, b;
+    auto none = [] {};
+    auto fill = [&] {
+        if constexpr (Kind::sized) {
+            C& c = Kind::make_empty(slot);
+            for (const T& value : values)
+                c.push_back(value);
+        }
+    };
+    auto release = [&] { slot.reset(); };
+
+    for (int i = 0; i < op_count; ++i) {
+        Op op = Op(i);
+        if (changes_size(op) && !Kind::sized)
+            continue;
+        // Per-call operations run in batches, so that cheap ones at small N
+        // still take well above the resolution of the clock
+        std::size_t batch = std::max<std::size_t>(1, 4096 / N);
+        std::size_t per = per_element(op) ? N : batch;
+        double& cell = table[op][column];
+        switch (op) {
+        case construct:
+            cell = measure(per, none, [&] {
+                for (std::size_t k = 0; k < batch; ++k)
+                    keep(Kind::make_full(slot, values[0]));
+            }, release);
+            break;
+        case push_back:
+            if constexpr (Kind::sized)
+                cell = measure(per, [&] { Kind::make_empty(slot); }, [&] {
+                    C& c = *slot;
+                    for (const T& value : values)
+                        c.push_back(value);
+                    keep(c);
+                }, release);
+            break;
+        case insert_front:
+        case insert_middle:
+        case insert_back:
+            if constexpr (Kind::sized)
+                cell = measure(per, [&] { Kind::make_empty(slot); }, [&] {
+                    C& c = *slot;
+                    for (const T& value : values) {
+                        std::size_t at = op == insert_front ? 0 : op == insert_middle ? c.size() / 2 : c.size();
+                        c.insert(c.begin() + at, value);
+                    }
+                    keep(c);
+                }, release);
+            break;
+        case erase_front:
+        case erase_middle:
+        case erase_back:
+            if constexpr (Kind::sized)
+                cell = measure(per, fill, [&] {
+                    C& c = *slot;
+                    while (!c.empty()) {
+                        std::size_t at = op == erase_front ? 0 : op == erase_middle ? c.size() / 2 : c.size() - 1;
+                        c.erase(c.begin() + at);
+                    }
+                    keep(c);
+                }, release);
+            break;
+        case copy:
+            Kind::make_full(a, values[1]);
+            cell = measure(per, none, [&] {
+                for (std::size_t k = 0; k < batch; ++k)
+                    keep(slot.emplace(*a));
+            }, release);
+            break;
+        case swap:
+            Kind::make_full(a, values[1]);
+            Kind::make_full(b, values[2]);
+            cell = measure(per, none, [&] {
+                using std::swap;
+                for (std::size_t k = 0; k < batch; ++k) {
+                    swap(*a, *b);
+                    keep(*a);
+                }
+            }, none);
+            break;
+        case compare:
+            Kind::make_full(a, values[1]);
+            Kind::make_full(b, values[1]);
+            cell = measure(per, none, [&] {
+                for (std::size_t k = 0; k < batch; ++k)
+                    keep(*a == *b);
+            }, none);
+            break;
+        case iterate:
+            Kind::make_full(slot, values[3]);
+            cell = measure(per, none, [&] {
+                std::size_t sum = 0;
+                for (const T& value : *slot)
+                    sum += key(value);
+                keep(sum);
+            }, none);
+            release();
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+template<class T, std::size_t N>
+void bench_table(const char* type_name, std::string_view filter) {
+    char title[64];
+    std::snprintf(title, sizeof(title), "%s, N = %zu", type_name, N);
+    if (std::string_view(title).find(filter) == std::string_view::npos)
+        return;
+
+    Table table;
+    for (Row& row : table)
+        row.fill(std::nan(""));
+    bench_container<MyVecKind<T, N>, T, N>(table, 0);
+    bench_container<VectorKind<T, N>, T, N>(table, 1);
+    bench_container<ReservedVectorKind<T, N>, T, N>(table, 2);
+    bench_container<ArrayKind<T, N>, T, N>(table, 3);
+#ifdef __cpp_lib_inplace_vector
+    bench_container<InplaceVectorKind<T, N>, T, N>(table, 4);
+#endif
+
+    std::printf("\n%-24s", title);
+    for (const char* name : column_names)
+        std::printf("%12s", name);
+    std::printf("\n");
+    for (int op = 0; op < op_count; ++op) {
+        std::printf("  %-14s%-8s", op_names[op], per_element(Op(op)) ? "ns/elem" : "ns/call");
+        for (double ns : table[op]) {
+            if (std::isnan(ns))
+                std::printf("%12s", "-");
+            else
+                std::printf("%12.2f", ns);
+        }
+        std::printf("\n");
+    }
+}
+
+template<std::size_t N>
+void bench_capacity(std::string_view filter) {
+    bench_table<int, N>("int", filter);
+    bench_table<double, N>("double", filter);
+    bench_table<std::string, N>("string", filter);
+    bench_table<Pod64, N>("Pod64", filter);
+}
+
+// Concurrent appends
+//
+// --concurrent splits concurrent_pushes int appends evenly across 1 to 64
+// threads, into a ConcurrentMyVec and into a reserved std::vector guarded by
+// a std::mutex. Cells are the best of five trials, in ns per push, timed from
+// releasing the started threads until the last one is joined. With fewer
+// cores than threads, the threads only time-slice, and the numbers show
+// per-push overhead rather than contention.
+
+constexpr std::size_t concurrent_pushes = std::size_t(1) << 20;
+
+// Runs push(value) concurrent_pushes times split across `threads` threads,
+// returning ns per push
+template<class Push>
+double time_pushes(int threads, Push push) {
+    std::atomic<bool> go = false;
+    std::vector<std::thread> pool;
+    std::size_t per_thread = concurrent_pushes / threads;
+    for (int t = 0; t < threads; ++t)
+        pool.emplace_back([&, t] {
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            for (std::size_t i = 0; i < per_thread; ++i)
+                push(int(t * per_thread + i));
+        });
+    clock::time_point start = clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& thread : pool)
+        thread.join();
+    return elapsed_ns(start, clock::now()) / (per_thread * threads);
+}
+
+int bench_concurrent() {
+    std::printf("concurrent appends, int, %zu pushes, %u hardware threads\n",
+                concurrent_pushes, std::thread::hardware_concurrency());
+    std::printf("  %-8s%18s%18s\n", "threads", "ConcurrentMyVec", "mutex + vector");
+    auto lock_free = std::make_unique<ConcurrentMyVec<int, concurrent_pushes>>();
+    std::vector<int> locked;
+    std::mutex mutex;
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        double best_lock_free = std::numeric_limits<double>::infinity();
+        double best_locked = std::numeric_limits<double>::infinity();
+        for (int trial = 0; trial < trials; ++trial) {
+            lock_free->clear();
+            best_lock_free = std::min(best_lock_free, time_pushes(threads, [&](int x) { lock_free->push_back(x); }));
+            if (lock_free->size() != concurrent_pushes)
+                return 1;
+
+            locked.clear();
+            locked.reserve(concurrent_pushes);
+            best_locked = std::min(best_locked, time_pushes(threads, [&](int x) {
+                std::lock_guard<std::mutex> lock(mutex);
+                locked.push_back(x);
+            }));
+        }
+        std::printf("  %-8d%18.1f%18.1f\n", threads, best_lock_free, best_locked);
+    }
+    return 0;
+}
+
+// Cursor-local edits
+//
+// --gap replays one stream of gap_edits edits on MyGapVec, MyVec and a
+// reserved std::vector, starting half full with the cursor in the middle.
+// Before each edit the cursor drifts by -2..+2, and only the drift moves it,
+// so it stays near the middle; then 60% of edits insert at the cursor and
+// 40% erase the element there. Edits go through insert(pos) and erase(pos),
+// which leave MyGapVec's gap at pos. Cells are ns per edit.
+
+constexpr std::size_t gap_edits = 200000;
+
+struct Edit {
+    bool insert;
+    std::size_t pos;
+};
+
+// The same stream for every container, kept within [0, N] elements
+template<std::size_t N>
+std::vector<Edit> make_edits() {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> drift(-2, 2);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::vector<Edit> edits;
+    std::size_t size = N / 2, cursor = size / 2;
+    for (std::size_t e = 0; e < gap_edits; ++e) {
+        cursor = std::size_t(std::clamp<long long>((long long)cursor + drift(rng), 0, (long long)size));
+        bool insert = size == 0 || (size < N && percent(rng) < 60);
+        if (insert) {
+            edits.push_back({true, cursor});
+            ++size;
+        } else {
+            if (cursor == size)
+                --cursor;
+            edits.push_back({false, cursor});
+            --size;
+        }
+    }
+    return edits;
+}
+
+template<class C, std::size_t N>
+double time_edits(const std::vector<Edit>& edits, bool reserve) {
+    Slot<C> slot;
+    return measure(edits.size(), [&] {
+        C& c = slot.emplace();
+        if constexpr (requires { c.reserve(N); })
+            if (reserve)
+                c.reserve(N);
+        for (std::size_t i = 0; i < N / 2; ++i)
+            c.push_back(int(i));
+    }, [&] {
+        C& c = *slot;
+        for (const Edit& e : edits) {
+            if (e.insert)
+                c.insert(c.begin() + e.pos, int(e.pos));
+            else
+                c.erase(c.begin() + e.pos);
+        }
+        keep(c);
+    }, [&] { slot.reset(); });
+}
+
+template<std::size_t N>
+void bench_gap_capacity() {
+    std::vector<Edit> edits = make_edits<N>();
+    std::printf("  %-10zu%12.1f%12.1f%12.1f\n", N,
+                time_edits<MyGapVec<int, N>, N>(edits, false),
+                time_edits<MyVec<int, N>, N>(edits, false),
+                time_edits<std::vector<int>, N>(edits, true));
+}
+
+int bench_gap() {
+    std::printf("cursor-local edits, int, %zu edits, ns/edit\n", gap_edits);
+    std::printf("  %-10s%12s%12s%12s\n", "capacity", "MyGapVec", "MyVec", "reserved");
+    bench_gap_capacity<64>();
+    bench_gap_capacity<1024>();
+    bench_gap_capacity<16384>();
+    bench_gap_capacity<262144>();
+    return 0;
+}
+
+// Expression templates
+//
+// --expr evaluates r = a + b * c - d over MyVec<double, expr_n> four ways:
+// naive, with a temporary MyVec per operator as operators returning vectors
+// would; fused through vec_expr.h, both by assignment, which converts to a
+// MyVec and then copies it into r, and by evaluate_into(r); and as a
+// hand-written single loop, the bound for the fused versions. Cells are us
+// per evaluation.
+
+constexpr std::size_t expr_n = 4096;
+
+using ExprVec = MyVec<double, expr_n>;
+
+template<class Op>
+ExprVec elementwise(const ExprVec& x, const ExprVec& y, Op op) {
+    ExprVec out(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        out[i] = op(x[i], y[i]);
+    return out;
+}
+
+int bench_expr() {
+    auto operands = std::make_unique<std::array<ExprVec, 5>>();
+    auto& [a, b, c, d, r] = *operands;
+    for (std::size_t i = 0; i < expr_n; ++i) {
+        a.push_back(double(i));
+        b.push_back(1.0 + double(i % 7));
+        c.push_back(0.5 * double(i % 13));
+        d.push_back(double(i % 3));
+    }
+    auto none = [] {};
+    double naive = measure(1, none, [&] {
+        r = elementwise(elementwise(a, elementwise(b, c, std::multiplies<>()), std::plus<>()), d, std::minus<>());
+        keep(r);
+    }, none);
+    double fused = measure(1, none, [&] {
+        r = a + b * c - d;
+        keep(r);
+    }, none);
+    double into = measure(1, none, [&] {
+        (a + b * c - d).evaluate_into(r);
+        keep(r);
+    }, none);
+    double loop = measure(1, none, [&] {
+        r.resize(expr_n);
+        for (std::size_t i = 0; i < expr_n; ++i)
+            r[i] = a[i] + b[i] * c[i] - d[i];
+        keep(r);
+    }, none);
+    std::printf("r = a + b * c - d, MyVec<double, %zu>, us per evaluation\n", expr_n);
+    std::printf("  %-16s%10.2f\n  %-16s%10.2f\n  %-16s%10.2f\n  %-16s%10.2f\n",
+                "naive", naive / 1e3, "fused, r = ...", fused / 1e3,
+                "evaluate_into", into / 1e3, "hand loop", loop / 1e3);
+    return 0;
+}
+
+// Matrices
+//
+// --matrix times MyMatrix<double, N, N> from N = 4 to 512, row-major and
+// column-major: operator* against the textbook i-j-k loop writing into an
+// existing matrix, and transpose() against copying element by element.
+// operator* and transpose() return by value, and the result is assigned to an
+// existing matrix, so they pay for one copy of it the loops do not. Cells are
+// us per operation.
+
+template<std::size_t N, class Layout>
+void bench_matrix_size() {
+    using M = MyMatrix<double, N, N, Layout>;
+    auto a = std::make_unique<M>(), b = std::make_unique<M>(), out = std::make_unique<M>();
+    for (std::size_t i = 0; i < N; ++i)
+        for (std::size_t j = 0; j < N; ++j) {
+            (*a)(i, j) = double((i * 7 + j) % 13);
+            (*b)(i, j) = double((i + j * 5) % 11);
+        }
+    // Small sizes repeat the operation within a sample to rise above the
+    // clock's resolution
+    constexpr std::size_t reps = std::max<std::size_t>(1, 4096 / (N * N));
+    auto none = [] {};
+    double loop_multiply = measure(reps, none, [&] {
+        for (std::size_t r = 0; r < reps; ++r) {
+            for (std::size_t i = 0; i < N; ++i)
+                for (std::size_t j = 0; j < N; ++j) {
+                    double sum = 0;
+                    for (std::size_t k = 0; k < N; ++k)
+                        sum += (*a)(i, k) * (*b)(k, j);
+                    (*out)(i, j) = sum;
+                }
+            keep(*out);
+        }
+    }, none);
+    double multiply = measure(reps, none, [&] {
+        for (std::size_t r = 0; r < reps; ++r) {
+            *out = *a * *b;
+            keep(*out);
+        }
+    }, none);
+    double loop_transpose = measure(reps, none, [&] {
+        for (std::size_t r = 0; r < reps; ++r) {
+            for (std::size_t i = 0; i < N; ++i)
+                for (std::size_t j = 0; j < N; ++j)
+                    (*out)(j, i) = (*a)(i, j);
+            keep(*out);
+        }
+    }, none);
+    double transpose = measure(reps, none, [&] {
+        for (std::size_t r = 0; r < reps; ++r) {
+            *out = a->transpose();
+            keep(*out);
+        }
+    }, none);
+    std::printf("  %3zux%-7zu%12.3f%12.3f%12.3f%12.3f\n", N, N, loop_multiply / 1e3, multiply / 1e3,
+                loop_transpose / 1e3, transpose / 1e3);
+}
+
+template<class Layout>
+void bench_matrix_layout(const char* name) {
+    std::printf("MyMatrix<double, N, N, %s>, us per operation\n", name);
+    std::printf("  %-11s%12s%12s%12s%12s\n", "", "i-j-k loop", "operator*", "copy loop", "transpose");
+    bench_matrix_size<4, Layout>();
+    bench_matrix_size<8, Layout>();
+    bench_matrix_size<16, Layout>();
+    bench_matrix_size<32, Layout>();
+    bench_matrix_size<64, Layout>();
+    bench_matrix_size<128, Layout>();
+    bench_matrix_size<256, Layout>();
+    bench_matrix_size<512, Layout>();
+}
+
+int bench_matrix() {
+    calibrate_clock();
+    bench_matrix_layout<row_major>("row_major");
+    std::printf("\n");
+    bench_matrix_layout<col_major>("col_major");
+    return 0;
+}
+
+// Constant evaluation
+//
+// --constexpr recompiles this file with -fsyntax-only once per operation and
+// container, defining BENCH_CONSTEXPR_OP, BENCH_CONSTEXPR_CONTAINER and
+// BENCH_REPS. The static_assert below then runs the operation BENCH_REPS
+// times in constant evaluation. Comparing compile times against
+// BENCH_REPS = 0 gives the cost of the evaluation alone; subtracting the
+// setup, building the empty or full containers, leaves the operation.
+//
+// The compiler and its flags come from $CXX (default g++) and
+// $BENCH_CXXFLAGS (default: GCC's flags lifting the evaluation limits).
+
+constexpr std::size_t constexpr_n = 64;
+constexpr int constexpr_reps = 200;
+
+// Pseudo-operations measuring the setup of the real ones
+enum ConstexprSetup { setup_empty = op_count, setup_full, constexpr_op_count };
+
+// seed varies the values; GCC memoizes constexpr calls with equal arguments,
+// so repeating an identical call would cost nothing
+template<class C>
+constexpr int constexpr_op(int op, int seed) {
+    constexpr std::size_t n = constexpr_n;
+    int sink = 0;
+    if (op == construct) {
+        C c(n, seed);
+        return int(c.size());
+    }
+    C a, b;
+    if ((op >= erase_front && op < op_count) || op == setup_full) {
+        for (std::size_t i = 0; i < n; ++i) {
+            a.push_back(int(i) + seed);
+            b.push_back(int(i) + seed);
+        }
+    }
+    switch (op) {
+    case push_back:
+        for (std::size_t i = 0; i < n; ++i)
+            a.push_back(int(i) + seed);
+        break;
+    case insert_front:
+    case insert_middle:
+    case insert_back:
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t at = op == insert_front ? 0 : op == insert_middle ? a.size() / 2 : a.size();
+            a.insert(a.begin() + at, int(i) + seed);
+        }
+        break;
+    case erase_front:
+    case erase_middle:
+    case erase_back:
+        while (!a.empty()) {
+            std::size_t at = op == erase_front ? 0 : op == erase_middle ? a.size() / 2 : a.size() - 1;
+            a.erase(a.begin() + at);
+        }
+        break;
+    case copy: {
+        C c = a;
+        sink += int(c.size());
+        break;
+    }
+    case swap: {
+        using std::swap;
+        swap(a, b);
+        break;
+    }
+    case compare:
+        sink += a == b;
+        break;
+    case iterate:
+        for (int x : a)
+            sink += x;
+        break;
+    default:
+        break;
+    }
+    return sink + int(a.size());
+}
+
+#ifdef BENCH_CONSTEXPR_OP
+#if BENCH_CONSTEXPR_CONTAINER == 0
+using ConstexprContainer = MyVec<int, constexpr_n>;
+#else
+using ConstexprContainer = std::vector<int>;
+#endif
+
+constexpr int constexpr_workload() {
+    int sink = 0;
+    for (int r = 0; r < BENCH_REPS; ++r)
+        sink += constexpr_op<ConstexprContainer>(BENCH_CONSTEXPR_OP, r);
+    return sink;
+}
+
+static_assert(constexpr_workload() >= 0);
+#endif
+
+// Best of three compile times of this file with `defines`, in seconds, or -1
+// on failure. If spread is given, it receives the difference between the
+// slowest and the fastest of the three.
+// Command checking this file with -fsyntax-only. `defines` come after the
+// flags, so they may also override them.
+std::string compile_command(const std::string& defines) {
+    const char* cxx = std::getenv("CXX");
+    const char* flags = std::getenv("BENCH_CXXFLAGS");
+    char command[1024];
+    std::snprintf(command, sizeof(command), "%s -std=c++20 %s -fsyntax-only %s %s",
+        cxx ? cxx : "g++", flags ? flags : "-fconstexpr-ops-limit=2147483647 -fconstexpr-loop-limit=1048576",
+        defines.c_str(), __FILE__);
+    return command;
+}
+
+double compile_seconds(const std::string& defines, double* spread = nullptr) {
+    std::string command = compile_command(defines);
+    double best = std::numeric_limits<double>::infinity();
+    double worst = 0;
+    for (int trial = 0; trial < 3; ++trial) {
+        clock::time_point t0 = clock::now();
+        if (std::system(command.c_str()) != 0)
+            return -1;
+        double seconds = elapsed_ns(t0, clock::now()) / 1e9;
+        best = std::min(best, seconds);
+        worst = std::max(worst, seconds);
+    }
+    if (spread)
+        *spread = worst - best;
+    return best;
+}
+
+double compile_seconds(int op, int container, int reps, double* spread = nullptr) {
+    return compile_seconds("-DBENCH_CONSTEXPR_OP=" + std::to_string(op) + " -DBENCH_CONSTEXPR_CONTAINER="
+                           + std::to_string(container) + " -DBENCH_REPS=" + std::to_string(reps), spread);
+}
+
+int bench_constexpr() {
+    const char* containers[] = {"MyVec", "std::vector"};
+    int container_count = 1;
+#ifdef __cpp_lib_constexpr_vector
+    container_count = 2;
+#endif
+    std::printf("constant evaluation, int, N = %zu, %d repetitions\n", constexpr_n, constexpr_reps);
+    std::printf("%-24s", "");
+    for (int c = 0; c < container_count; ++c)
+        std::printf("%12s", containers[c]);
+    std::printf("\n");
+
+    // Costs within the run-to-run noise of compiling the file without any
+    // evaluation are printed as "~0"; raise constexpr_reps to resolve them
+    std::array<std::array<double, constexpr_op_count>, 2> per_rep;
+    std::array<double, 2> resolution;
+    for (int c = 0; c < container_count; ++c) {
+        double spread;
+        double parse = compile_seconds(construct, c, 0, &spread);
+        if (parse < 0)
+            return 1;
+        resolution[c] = spread / constexpr_reps;
+        for (int op = 0; op < constexpr_op_count; ++op) {
+            double total = compile_seconds(op, c, constexpr_reps);
+            if (total < 0)
+                return 1;
+            per_rep[c][op] = (total - parse) / constexpr_reps;
+        }
+    }
+    for (int op = 0; op < op_count; ++op) {
+        std::printf("  %-14s%-8s", op_names[op], per_element(Op(op)) ? "us/elem" : "us/call");
+        for (int c = 0; c < container_count; ++c) {
+            double setup = op == construct ? 0 : per_rep[c][op >= erase_front ? setup_full : setup_empty];
+            double per = per_element(Op(op)) ? constexpr_n : 1;
+            double cost = (per_rep[c][op] - setup) / per;
+            if (cost <= resolution[c] / per)
+                std::printf("%12s", "~0");
+            else
+                std::printf("%12.3f", cost * 1e6);
+        }
+        std::printf("\n");
+    }
+    return 0;
+}
+
+// Priority queues
+//
+// --heap pushes heap_n random 32-bit keys into an empty queue, then pops
+// them all, timing each phase in ns per element. It compares
+// std::priority_queue with MyPriorityQueue at arities 2, 4 and 8.
+//
+// It then times the same workload at compile time, on heap_constexpr_n keys
+// in a constexpr variable, by compiling this file with -fsyntax-only as
+// --constexpr does. std::priority_queue is not usable in constant
+// evaluation before C++26, so the baseline there is std::push_heap and
+// std::pop_heap on a std::vector, which is what std::priority_queue does.
+
+constexpr std::size_t heap_n = std::size_t(1) << 20;
+constexpr std::size_t heap_constexpr_n = 3000;
+
+#ifdef BENCH_CONSTEXPR_HEAP
+// BENCH_CONSTEXPR_HEAP is the arity, or 0 for the std heap; BENCH_HEAP_N is
+// the number of keys, 0 to time parsing alone
+constexpr unsigned heap_workload() {
+    unsigned x = 12345, sink = 0;
+#if BENCH_CONSTEXPR_HEAP == 0
+    std::vector<unsigned> q;
+    for (std::size_t i = 0; i < BENCH_HEAP_N; ++i) {
+        q.push_back(x = x * 1103515245 + 12345);
+        std::push_heap(q.begin(), q.end());
+    }
+    while (!q.empty()) {
+        std::pop_heap(q.begin(), q.end());
+        sink ^= q.back();
+        q.pop_back();
+    }
+#else
+    MyPriorityQueue<unsigned, heap_constexpr_n, std::less<unsigned>, BENCH_CONSTEXPR_HEAP> q;
+    for (std::size_t i = 0; i < BENCH_HEAP_N; ++i)
+        q.push(x = x * 1103515245 + 12345);
+    while (!q.empty()) {
+        sink ^= q.top();
+        q.pop();
+    }
+#endif
+    return sink;
+}
+
+constexpr unsigned heap_result = heap_workload();
+#endif
+
+// ns per element to push every key, and to pop them all again
+template<class Q>
+std::pair<double, double> time_heap(const std::vector<std::uint32_t>& keys) {
+    Slot<Q> slot;
+    auto fill = [&] {
+        Q& q = slot.emplace();
+        for (std::uint32_t key : keys)
+            q.push(key);
+    };
+    double push = measure(keys.size(), [&] { slot.emplace(); }, [&] {
+        Q& q = *slot;
+        for (std::uint32_t key : keys)
+            q.push(key);
+        keep(q);
+    }, [&] { slot.reset(); });
+    double pop = measure(keys.size(), fill, [&] {
+        Q& q = *slot;
+        std::uint32_t sink = 0;
+        while (!q.empty()) {
+            sink ^= q.top();
+            q.pop();
+        }
+        keep(sink);
+    }, [&] { slot.reset(); });
+    return {push, pop};
+}
+
+int bench_heap() {
+    std::mt19937 rng(42);
+    std::vector<std::uint32_t> keys(heap_n);
+    for (std::uint32_t& key : keys)
+        key = rng();
+
+    std::printf("priority queues, %zu random 32-bit keys, ns/elem\n", heap_n);
+    std::printf("  %-22s%10s%10s\n", "", "push", "pop");
+    auto row = [](const char* name, std::pair<double, double> t) {
+        std::printf("  %-22s%10.1f%10.1f\n", name, t.first, t.second);
+    };
+    row("std::priority_queue", time_heap<std::priority_queue<std::uint32_t>>(keys));
+    row("MyPriorityQueue D = 2", time_heap<MyPriorityQueue<std::uint32_t, heap_n, std::less<std::uint32_t>, 2>>(keys));
+    row("MyPriorityQueue D = 4", time_heap<MyPriorityQueue<std::uint32_t, heap_n, std::less<std::uint32_t>, 4>>(keys));
+    row("MyPriorityQueue D = 8", time_heap<MyPriorityQueue<std::uint32_t, heap_n, std::less<std::uint32_t>, 8>>(keys));
+
+    std::printf("\ncompile time, push and pop %zu keys in a constexpr variable, s\n", heap_constexpr_n);
+    auto defines = [](int arity, std::size_t n) {
+        return "-DBENCH_CONSTEXPR_HEAP=" + std::to_string(arity) + " -DBENCH_HEAP_N=" + std::to_string(n);
+    };
+    const char* names[] = {"std heap on std::vector", "", "MyPriorityQueue D = 2", "", "MyPriorityQueue D = 4"};
+    for (int arity : {0, 2, 4}) {
+        double parse = compile_seconds(defines(arity, 0));
+        double total = compile_seconds(defines(arity, heap_constexpr_n));
+        if (parse < 0 || total < 0)
+            return 1;
+        std::printf("  %-24s%8.2f\n", names[arity], total - parse);
+    }
+    return 0;
+}
+
+// Range queries
+//
+// --range times the indexes of vec_range_query.h over n random ints. Building
+// them: the compile time of a constexpr MyVec<int, n> together with the
+// PrefixSumIndex and min SparseTable that make_prefix_sum_index and
+// make_sparse_table build from it, less that of the MyVec alone, compiling
+// this file with -fsyntax-only as --constexpr does. Querying: range_queries
+// random non-empty [l, r), each asking for the sum and the minimum, through
+// both indexes and by scanning the range. The indexes are built at runtime
+// there, with the constructors the make_* functions call. Query cells are ns
+// per query.
+
+constexpr std::size_t range_queries = 1000000;
+
+#ifdef BENCH_RANGE_N
+// BENCH_RANGE_INDEX is 1 to build the indexes, 0 to time the data alone
+constexpr MyVec<int, BENCH_RANGE_N> range_data = [] {
+    MyVec<int, BENCH_RANGE_N> v;
+    unsigned x = 12345;
+    for (std::size_t i = 0; i < BENCH_RANGE_N; ++i)
+        v.push_back(int((x = x * 1103515245 + 12345) >> 16) % 1000);
+    return v;
+}();
+
+#if BENCH_RANGE_INDEX
+constexpr auto range_sums = make_prefix_sum_index(range_data);
+constexpr auto range_mins = make_sparse_table<min_op>(range_data);
+static_assert(range_sums.size() == BENCH_RANGE_N && range_mins.size() == BENCH_RANGE_N);
+#endif
+#endif
+
+template<std::size_t N>
+int bench_range_size() {
+    auto defines = [](int index) {
+        return "-DBENCH_RANGE_N=" + std::to_string(N) + " -DBENCH_RANGE_INDEX=" + std::to_string(index);
+    };
+    double spread;
+    double data_only = compile_seconds(defines(0), &spread);
+    double with_index = compile_seconds(defines(1));
+    if (data_only < 0 || with_index < 0)
+        return 1;
+    // Builds within the run-to-run noise of compiling the data alone
+    char build[32] = "~0";
+    if (with_index - data_only > spread)
+        std::snprintf(build, sizeof(build), "%.2f", with_index - data_only);
+
+    std::mt19937 rng(42);
+    std::vector<int> data(N);
+    for (int& x : data)
+        x = int(rng() % 1000);
+    std::vector<std::pair<std::size_t, std::size_t>> queries(range_queries);
+    for (auto& [l, r] : queries) {
+        l = rng() % N;
+        r = l + 1 + rng() % (N - l);
+    }
+    auto sums = std::make_unique<PrefixSumIndex<int, N>>(data.data(), N);
+    auto mins = std::make_unique<SparseTable<int, N, min_op>>(data.data(), N);
+
+    auto none = [] {};
+    double indexed = measure(queries.size(), none, [&] {
+        long long sink = 0;
+        for (auto [l, r] : queries)
+            sink += sums->sum(l, r) + mins->query(l, r);
+        keep(sink);
+    }, none);
+    double scanned = measure(queries.size(), none, [&] {
+        long long sink = 0;
+        for (auto [l, r] : queries) {
+            int sum = 0, min = data[l];
+            for (std::size_t i = l; i < r; ++i) {
+                sum += data[i];
+                min = std::min(min, data[i]);
+            }
+            sink += sum + min;
+        }
+        keep(sink);
+    }, none);
+    std::printf("  %-8zu%12s%12.1f%12.1f\n", N, build, indexed, scanned);
+    return 0;
+}
+
+int bench_range() {
+    calibrate_clock();
+    std::printf("sum and min of %zu random ranges over n random ints\n", range_queries);
+    std::printf("  %-8s%12s%12s%12s\n", "n", "build, s", "index, ns", "scan, ns");
+    if (bench_range_size<256>() || bench_range_size<1024>() || bench_range_size<4096>())
+        return 1;
+    return 0;
+}
+
+// Sorting
+//
+// --sort times sort() from vec_algorithms.h against std::sort on a
+// MyVec<int, N> holding N random ints. At N = 8 and 32, sort() runs a sorting
+// network; at N = 1000 and 100000, an LSD radix sort. Cells are us per sort,
+// refilling the MyVec before each one untimed.
+//
+// It then fills a constexpr MyVec<int, N> and sorts it in constant
+// evaluation at N = sort_constexpr_n, compiling this file with -fsyntax-only
+// as --constexpr does. Besides the compile time, it finds the smallest
+// -fconstexpr-ops-limit the evaluation fits in, which unlike the time does
+// not depend on the machine. Both are given less those of the fill alone.
+
+constexpr std::size_t sort_constexpr_n[] = {2000, 8000};
+
+#ifdef BENCH_SORT
+// BENCH_SORT is 0 to fill the MyVec alone, 1 to also std::sort it and 2 to
+// sort() it; BENCH_SORT_N is its size
+constexpr int sort_workload() {
+    MyVec<int, BENCH_SORT_N> v;
+    unsigned x = 12345;
+    for (std::size_t i = 0; i < BENCH_SORT_N; ++i)
+        v.push_back(int((x = x * 1103515245 + 12345) >> 1));
+#if BENCH_SORT == 1
+    std::sort(v.begin(), v.end());
+#elif BENCH_SORT == 2
+    sort(v);
+#endif
+    return v[0] ^ v[BENCH_SORT_N / 2];
+}
+
+constexpr int sort_result = sort_workload();
+#endif
+
+// The smallest -fconstexpr-ops-limit under which this file compiles with
+// `defines`, to within 1%, or -1 if it does not compile under any
+long long min_ops_limit(const std::string& defines) {
+    auto compiles = [&](long long limit) {
+        std::string command = compile_command(defines + " -fconstexpr-ops-limit=" + std::to_string(limit));
+        return std::system((command + " 2>/dev/null").c_str()) == 0;
+    };
+    constexpr long long max_limit = std::numeric_limits<std::int32_t>::max();
+    long long lo = 0, hi = 1 << 20;
+    while (!compiles(hi)) {
+        if (hi == max_limit)
+            return -1;
+        lo = hi;
+        hi = std::min(2 * hi, max_limit);
+    }
+    while (hi - lo > hi / 100) {
+        long long mid = lo + (hi - lo) / 2;
+        (compiles(mid) ? hi : lo) = mid;
+    }
+    return hi;
+}
+
+template<std::size_t N>
+void bench_sort_size() {
+    using V = MyVec<int, N>;
+    std::mt19937 rng(42);
+    std::vector<int> values(N);
+    for (int& x : values)
+        x = int(rng() >> 1);
+    Slot<V> slot;
+    V& v = slot.emplace(N);
+    auto refill = [&] { std::copy(values.begin(), values.end(), v.begin()); };
+    auto none = [] {};
+    double std_sort = measure(1, refill, [&] {
+        std::sort(v.begin(), v.end());
+        keep(v);
+    }, none);
+    double my_sort = measure(1, refill, [&] {
+        sort(v);
+        keep(v);
+    }, none);
+    std::printf("  %-8zu%-10s%12.3f%12.3f\n", N, N <= 32 ? "network" : "radix", std_sort / 1e3, my_sort / 1e3);
+}
+
+int bench_sort() {
+    calibrate_clock();
+    std::printf("sort a MyVec<int, N> of N random ints, us per sort\n");
+    std::printf("  %-8s%-10s%12s%12s\n", "N", "sort()", "std::sort", "sort()");
+    bench_sort_size<8>();
+    bench_sort_size<32>();
+    bench_sort_size<1000>();
+    bench_sort_size<100000>();
+
+    std::printf("\nconstexpr fill and sort of a MyVec<int, N>, less the fill alone\n");
+    std::printf("  %-8s%14s%14s%16s%16s\n", "N", "std::sort, s", "sort(), s", "std::sort, ops", "sort(), ops");
+    for (std::size_t n : sort_constexpr_n) {
+        auto defines = [n](int workload) {
+            return "-DBENCH_SORT=" + std::to_string(workload) + " -DBENCH_SORT_N=" + std::to_string(n);
+        };
+        double seconds[3], spread;
+        long long ops[3];
+        for (int workload = 0; workload < 3; ++workload) {
+            seconds[workload] = compile_seconds(defines(workload), workload == 0 ? &spread : nullptr);
+            ops[workload] = min_ops_limit(defines(workload));
+            if (seconds[workload] < 0 || ops[workload] < 0)
+                return 1;
+        }
+        // Times within the run-to-run noise of compiling the fill alone
+        char cost[2][32];
+        for (int workload = 1; workload < 3; ++workload) {
+            double extra = seconds[workload] - seconds[0];
+            if (extra > spread)
+                std::snprintf(cost[workload - 1], sizeof(cost[0]), "%.2f", extra);
+            else
+                std::snprintf(cost[workload - 1], sizeof(cost[0]), "~0");
+        }
+        std::printf("  %-8zu%14s%14s%16lld%16lld\n", n, cost[0], cost[1], ops[1] - ops[0], ops[2] - ops[0]);
+    }
+    return 0;
+}
+
+// Prime sieves
+//
+// --sieve computes a sieve of Eratosthenes up to N in a constexpr variable,
+// on a MyVec<bool, N> and on a MyBitVec<N>, by compiling this file to an
+// object file with -O2 and the compiler's default constexpr limits. Cells are
+// the time of one compile and the size of the object's .rodata, which holds
+// the table, both less those of compiling without a sieve; or the limit the
+// evaluation ran into.
+
+constexpr std::size_t sieve_n[] = {100000, 200000, 400000, 600000};
+
+#ifdef BENCH_SIEVE_N
+// BENCH_SIEVE_BITS is 1 for MyBitVec, 0 for MyVec<bool>. Element i is set
+// when i is composite.
+constexpr auto make_sieve() {
+#if BENCH_SIEVE_BITS
+    MyBitVec<BENCH_SIEVE_N> composite(BENCH_SIEVE_N);
+    composite.set(0).set(1);
+    for (std::size_t p = 2; p * p < BENCH_SIEVE_N; ++p)
+        if (!composite[p])
+            composite.set_stride(p * p, p);
+#else
+    MyVec<bool, BENCH_SIEVE_N> composite(BENCH_SIEVE_N);
+    composite[0] = composite[1] = true;
+    for (std::size_t p = 2; p * p < BENCH_SIEVE_N; ++p)
+        if (!composite[p])
+            for (std::size_t m = p * p; m < BENCH_SIEVE_N; m += p)
+                composite[m] = true;
+#endif
+    return composite;
+}
+
+}  // namespace
+
+// External linkage keeps the table in the object file
+extern constexpr auto sieve_table = make_sieve();
+
+namespace {
+#endif
+
+// Compiles this file with `defines` into `object`, giving the time it took and
+// the size of the object's .rodata* sections as listed by size -A. Returns
+// an empty string on success, or the reason compiling failed.
+std::string compile_object(const std::string& defines, const std::string& object, double& seconds,
+                           unsigned long long& rodata) {
+    const char* cxx = std::getenv("CXX");
+    std::string command = std::string(cxx ? cxx : "g++") + " -std=c++20 -O2 -c " + defines + " " + __FILE__
+                          + " -o " + object + " 2>&1";
+    clock::time_point t0 = clock::now();
+    FILE* out = popen(command.c_str(), "r");
+    if (!out)
+        return "cannot run the compiler";
+    std::string diagnostics;
+    char buf[4096];
+    while (std::size_t count = std::fread(buf, 1, sizeof(buf), out))
+        diagnostics.append(buf, count);
+    bool compiled = pclose(out) == 0;
+    seconds = elapsed_ns(t0, clock::now()) / 1e9;
+    if (!compiled) {
+        if (diagnostics.find("loop iteration count exceeds limit") != std::string::npos)
+            return "fails: loop limit";
+        if (diagnostics.find("operation count exceeds limit") != std::string::npos)
+            return "fails: ops limit";
+        return "fails: other error";
+    }
+
+    rodata = 0;
+    if (FILE* sizes = popen(("size -A " + object).c_str(), "r")) {
+        char line[256], name[128];
+        unsigned long long bytes;
+        while (std::fgets(line, sizeof(line), sizes))
+            if (std::sscanf(line, "%127s %llu", name, &bytes) == 2 && std::strncmp(name, ".rodata", 7) == 0)
+                rodata += bytes;
+        pclose(sizes);
+    }
+    return "";
+}
+
+int bench_sieve() {
+    std::string object = (std::filesystem::temp_directory_path() / "bench_sieve.o").string();
+    double base_seconds;
+    unsigned long long base_rodata;
+    std::string failure = compile_object("", object, base_seconds, base_rodata);
+    if (!failure.empty()) {
+        std::fprintf(stderr, "compiling without a sieve: %s\n", failure.c_str());
+        return 1;
+    }
+    std::printf("constexpr sieve of Eratosthenes up to N, -O2, default constexpr limits\n");
+    std::printf("less the %.1f s and %llu B of .rodata of compiling without a sieve\n", base_seconds, base_rodata);
+    std::printf("  %-10s%-24s%-24s\n", "N", "MyVec<bool, N>", "MyBitVec<N>");
+    for (std::size_t n : sieve_n) {
+        std::string cells[2];
+        for (int bits = 0; bits < 2; ++bits) {
+            double seconds;
+            unsigned long long rodata;
+            cells[bits] = compile_object("-DBENCH_SIEVE_N=" + std::to_string(n) + " -DBENCH_SIEVE_BITS="
+                                         + std::to_string(bits), object, seconds, rodata);
+            if (cells[bits].empty()) {
+                char cell[64];
+                std::snprintf(cell, sizeof(cell), "%.1f s  %llu B", seconds - base_seconds, rodata - base_rodata);
+                cells[bits] = cell;
+            }
+        }
+        std::printf("  %-10zu%-24s%-24s\n", n, cells[0].c_str(), cells[1].c_str());
+    }
+    std::filesystem::remove(object);
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string_view arg = argc > 1 ? argv[1] : "";
+    if (arg == "--constexpr")
+        return bench_constexpr();
+    if (arg == "--concurrent")
+        return bench_concurrent();
+    if (arg == "--gap")
+        return bench_gap();
+    if (arg == "--expr")
+        return bench_expr();
+    if (arg == "--heap")
+        return bench_heap();
+    if (arg == "--matrix")
+        return bench_matrix();
+    if (arg == "--range")
+        return bench_range();
+    if (arg == "--sort")
+        return bench_sort();
+    if (arg == "--sieve")
+        return bench_sieve();
+
+    calibrate_clock();
+    std::printf("clock overhead %.1f ns, subtracted from every sample\n", clock_overhead_ns);
+    bench_capacity<16>(arg);
+    bench_capacity<256>(arg);
+    bench_capacity<4096>(arg);
+}
@@ -0,0 +1,89 @@
+#!/usr/bin/env bash
+# Build-time benchmark for the MyVec headers and the my_vector module.
+#
+#     ./bench_build.sh [TUs]        # default 20 translation units
+#
+# Generates TUs that each use MyVec<int, 64> (push_back, insert, copy, ==)
+# and compiles them one after another with $CXX (default g++) -std=c++20 -O2,
+# three ways:
+#
+#   heavy   my_vector.h after the standard headers it used to pull in
+#           (<iostream>, <vector>, <functional>, <concepts>, and <format>
+#           where the library has it)
+#   header  my_vector.h alone
+#   module  import my_vector; the module is built once first, and that build
+#           is reported separately
+#
+# Prints the total compile time of each mode and the preprocessed lines per TU.
+
+set -euo pipefail
+
+tus=${1:-20}
+cxx=${CXX:-g++}
+here=$(cd "$(dirname "$0")" && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+body() {
+    cat <<EOF
+int use_$1(int x) {
+    MyVec<int, 64> v;
+    for (int k = 0; k < 32; ++k)
+        v.push_back(x + k);
+    v.insert(v.begin() + 3, x);
+    MyVec<int, 64> w = v;
+    return (v == w) + int(v.size());
+}
+EOF
+}
+
+for mode in heavy header module; do
+    mkdir -p "$work/$mode"
+    for ((i = 0; i < tus; ++i)); do
+        {
+            case $mode in
+            heavy)
+                printf '#include <concepts>\n#include <functional>\n#include <iostream>\n#include <vector>\n'
+                printf '#if __has_include(<format>)\n#include <format>\n#endif\n#include "my_vector.h"\n' ;;
+            header)
+                printf '#include "my_vector.h"\n' ;;
+            module)
+                printf 'import my_vector;\n' ;;
+            esac
+            body "$i"
+        } > "$work/$mode/tu$i.cpp"
+    done
+done
+
+seconds() {
+    local start end
+    start=$(date +%s%N)
+    "$@"
+    end=$(date +%s%N)
+    awk -v ns=$((end - start)) 'BEGIN { print ns / 1e9 }'
+}
+
+compile_all() {
+    local mode=$1
+    shift
+    for ((i = 0; i < tus; ++i)); do
+        "$cxx" -std=c++20 -O2 "$@" -c "$work/$mode/tu$i.cpp" -o "$work/$mode/tu$i.o"
+    done
+}
+
+lines() {
+    local mode=$1
+    shift
+    "$cxx" -std=c++20 "$@" -E "$work/$mode/tu0.cpp" | wc -l
+}
+
+echo "$tus TUs, $cxx -std=c++20 -O2, compiled one at a time"
+printf '  %-8s%10s%14s\n' mode seconds lines/TU
+printf '  %-8s%10.2f%14d\n' heavy "$(seconds compile_all heavy -I "$here")" "$(lines heavy -I "$here")"
+printf '  %-8s%10.2f%14d\n' header "$(seconds compile_all header -I "$here")" "$(lines header -I "$here")"
+
+# GCC looks for compiled module interfaces in ./gcm.cache
+cd "$work/module"
+module_seconds=$(seconds "$cxx" -std=c++20 -O2 -fmodules-ts -I "$here" -x c++ -c "$here/my_vector.cppm" -o my_vector.o)
+printf '  %-8s%10.2f%14s   (+%.2f s to build the module)\n' module \
+    "$(seconds compile_all module -fmodules-ts)" - "$module_seconds"
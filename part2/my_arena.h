@@ -0,0 +1,154 @@
+#ifndef MY_ARENA_H_
+#define MY_ARENA_H_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+// std::pmr::memory_resources over a fixed buffer held inside the resource, so
+// a std::pmr::vector (or any other pmr container) gets the usual interface
+// without touching the heap:
+//
+//     static VecArena<int, 1000> arena;
+//     std::pmr::vector<int> v(&arena);
+//
+// Running out of space throws std::bad_alloc; there is deliberately no
+// fallback to the heap. Neither resource is thread-safe.
+
+enum class ArenaMode {
+    // Bump allocation; deallocate is a no-op and release() frees everything.
+    monotonic,
+    // Power-of-two size classes with free lists, so memory handed back is
+    // reused by later allocations of the same class.
+    pooled,
+};
+
+template<std::size_t Bytes, ArenaMode Mode = ArenaMode::monotonic>
+class StaticArenaResource : public std::pmr::memory_resource {
+public:
+    static constexpr ArenaMode mode = Mode;
+
+    StaticArenaResource() noexcept = default;
+    StaticArenaResource(const StaticArenaResource&) = delete;
+    StaticArenaResource& operator=(const StaticArenaResource&) = delete;
+
+    static constexpr std::size_t capacity() noexcept { return Bytes; }
+
+    // Bytes of the buffer handed out so far, including blocks sitting in
+    // free lists
+    std::size_t used() const noexcept { return top; }
+
+    // Makes the whole buffer available again. Everything allocated from the
+    // resource must already be gone.
+    void release() noexcept {
+        top = 0;
+        free_lists = {};
+    }
+
+private:
+    static constexpr std::size_t min_block = 16;
+    static constexpr std::size_t size_classes = std::bit_width(Bytes);
+
+    alignas(std::max_align_t) std::array<std::byte, Bytes> buffer;
+    std::size_t top = 0;
+    std::array<void*, size_classes> free_lists = {};
+
+    static constexpr std::size_t _block_size(std::size_t bytes, std::size_t alignment) noexcept {
+        return std::bit_ceil(std::max({bytes, alignment, min_block}));
+    }
+
+    static constexpr std::size_t _size_class(std::size_t block) noexcept {
+        return std::countr_zero(block) - std::countr_zero(min_block);
+    }
+
+    void* _bump(std::size_t bytes, std::size_t alignment) {
+        void* p = buffer.data() + top;
+        std::size_t space = Bytes - top;
+        if (!std::align(alignment, bytes, p, space))
+            throw std::bad_alloc();
+        top = static_cast<std::byte*>(p) - buffer.data() + bytes;
+        return p;
+    }
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        if constexpr (Mode == ArenaMode::pooled) {
+            std::size_t block = _block_size(bytes, alignment);
+            if (block > Bytes)
+                throw std::bad_alloc();
+            void*& head = free_lists[_size_class(block)];
+            if (head && reinterpret_cast<std::uintptr_t>(head) % alignment == 0) {
+                void* p = head;
+                head = *static_cast<void**>(p);
+                return p;
+            }
+            return _bump(block, alignment);
+        } else {
+            return _bump(bytes, alignment);
+        }
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        if constexpr (Mode == ArenaMode::pooled) {
+            void*& head = free_lists[_size_class(_block_size(bytes, alignment))];
+            *static_cast<void**>(p) = head;
+            head = p;
+        }
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// Arena bytes for a std::pmr::vector<T> to reach N elements one push_back at
+// a time, assuming the doubling growth of libstdc++ and libc++: every
+// capacity 1, 2, 4, ..., bit_ceil(N) is allocated once.
+template<class T, std::size_t N, ArenaMode Mode = ArenaMode::monotonic>
+inline constexpr std::size_t arena_bytes = Mode == ArenaMode::monotonic
+    ? 2 * std::bit_ceil(N) * sizeof(T) + alignof(T)
+    : 2 * std::bit_ceil(std::max<std::size_t>(std::bit_ceil(N) * sizeof(T), 16));
+
+// Arena sized for a vector of up to N elements of type T, following MyVec<T, N>
+template<class T, std::size_t N, ArenaMode Mode = ArenaMode::monotonic>
+using VecArena = StaticArenaResource<arena_bytes<T, N, Mode>, Mode>;
+
+// Forwards to another resource, counting the traffic. Wrap the default
+// resource in one to compare against an arena:
+//
+//     CountingResource heap(std::pmr::new_delete_resource());
+class CountingResource : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+        : upstream(upstream) {}
+
+    std::size_t allocations() const noexcept { return allocs; }
+    std::size_t deallocations() const noexcept { return deallocs; }
+    std::size_t bytes_allocated() const noexcept { return bytes_total; }
+
+    void reset_counts() noexcept { allocs = deallocs = bytes_total = 0; }
+
+private:
+    std::pmr::memory_resource* upstream;
+    std::size_t allocs = 0;
+    std::size_t deallocs = 0;
+    std::size_t bytes_total = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        void* p = upstream->allocate(bytes, alignment);
+        ++allocs;
+        bytes_total += bytes;
+        return p;
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        ++deallocs;
+        upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+#endif  // MY_ARENA_H_
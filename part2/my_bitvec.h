@@ -0,0 +1,315 @@
+#ifndef MY_BITVEC_H_
+#define MY_BITVEC_H_
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+// Fixed-capacity vector of bools packed 64 to a word, with the push_back /
+// resize semantics of MyVec<bool, N> at 1/8 of the storage.
+//
+// Word-level queries (count, find_first/find_next, rank, select) go through
+// std::popcount and std::countr_zero, which compile to popcnt/tzcnt where the
+// target has them and remain usable in constant evaluation.
+//
+// Invariant: bits at positions >= size() are always zero.
+template<std::size_t N>
+class MyBitVec {
+public:
+    // Member types
+    using word_type = std::uint64_t;
+    using size_type = std::size_t;
+
+    static constexpr size_type word_bits = 64;
+    static constexpr size_type word_count = (N + word_bits - 1) / word_bits;
+    static constexpr size_type static_capacity = N;
+    static constexpr size_type npos = size_type(-1);
+
+    // Proxy returned by the non-const operator[]
+    class reference {
+    public:
+        constexpr reference& operator=(bool value) noexcept {
+            if (value) *word |= mask; else *word &= ~mask;
+            return *this;
+        }
+        constexpr reference& operator=(const reference& other) noexcept { return *this = bool(other); }
+        constexpr operator bool() const noexcept { return (*word & mask) != 0; }
+        constexpr bool operator~() const noexcept { return !bool(*this); }
+        constexpr reference& flip() noexcept { *word ^= mask; return *this; }
+
+    private:
+        friend class MyBitVec;
+        constexpr reference(word_type* word, word_type mask) noexcept : word(word), mask(mask) {}
+
+        word_type* word;
+        word_type mask;
+    };
+
+    // Constructors
+    // copy & move implicitly defined
+    constexpr MyBitVec() noexcept : words() {}
+
+    constexpr explicit MyBitVec(size_type count, bool value = false) : words() { resize(count, value); }
+
+    constexpr MyBitVec(std::initializer_list<bool> init) : words() {
+        _check_length(init.size());
+        for (bool value : init)
+            push_back(value);
+    }
+
+    // Element access
+    constexpr bool operator[](size_type pos) const { return (words[pos / word_bits] >> (pos % word_bits)) & 1; }
+    constexpr reference operator[](size_type pos) { return reference(&words[pos / word_bits], word_type(1) << (pos % word_bits)); }
+
+    constexpr bool test(size_type pos) const {
+        _check_index(pos);
+        return (*this)[pos];
+    }
+
+    constexpr bool front() const { return (*this)[0]; }
+    constexpr bool back() const { return (*this)[sz - 1]; }
+
+    // The packed words; bits past size() are zero.
+    constexpr const word_type* data() const noexcept { return words.data(); }
+    constexpr size_type words_in_use() const noexcept { return (sz + word_bits - 1) / word_bits; }
+
+    // Capacity
+    [[nodiscard]] constexpr bool empty() const noexcept { return sz == 0; }
+    constexpr size_type size() const noexcept { return sz; }
+    constexpr size_type max_size() const noexcept { return N; }
+    constexpr size_type capacity() const noexcept { return N; }
+
+    // Modifiers
+    constexpr void clear() noexcept {
+        for (size_type w = 0; w < words_in_use(); ++w)
+            words[w] = 0;
+        sz = 0;
+    }
+
+    constexpr void push_back(bool value) {
+        _check_length(sz + 1);
+        if (value)
+            words[sz / word_bits] |= word_type(1) << (sz % word_bits);
+        ++sz;
+    }
+
+    constexpr void pop_back() { (*this)[--sz] = false; }
+
+    constexpr void resize(size_type count, bool value = false) {
+        _check_length(count);
+        if (count < sz) {
+            size_type old = sz;
+            sz = count;
+            _clear(count, old);
+            return;
+        }
+        if (value)
+            _fill(sz, count);
+        sz = count;
+    }
+
+    constexpr MyBitVec& set(size_type pos, bool value = true) {
+        _check_index(pos);
+        (*this)[pos] = value;
+        return *this;
+    }
+
+    constexpr MyBitVec& reset(size_type pos) { return set(pos, false); }
+
+    constexpr MyBitVec& flip(size_type pos) {
+        _check_index(pos);
+        (*this)[pos].flip();
+        return *this;
+    }
+
+    // Bulk operations over the current size
+    constexpr MyBitVec& set() noexcept {
+        _fill(0, sz);
+        return *this;
+    }
+
+    constexpr MyBitVec& reset() noexcept {
+        for (size_type w = 0; w < words_in_use(); ++w)
+            words[w] = 0;
+        return *this;
+    }
+
+    constexpr MyBitVec& flip() noexcept {
+        for (size_type w = 0; w < words_in_use(); ++w)
+            words[w] = ~words[w];
+        _trim();
+        return *this;
+    }
+
+    // Element-wise with another vector of the same size
+    constexpr MyBitVec& operator&=(const MyBitVec& other) {
+        _check_same_size(other);
+        for (size_type w = 0; w < words_in_use(); ++w)
+            words[w] &= other.words[w];
+        return *this;
+    }
+
+    constexpr MyBitVec& operator|=(const MyBitVec& other) {
+        _check_same_size(other);
+        for (size_type w = 0; w < words_in_use(); ++w)
+            words[w] |= other.words[w];
+        return *this;
+    }
+
+    constexpr MyBitVec& operator^=(const MyBitVec& other) {
+        _check_same_size(other);
+        for (size_type w = 0; w < words_in_use(); ++w)
+            words[w] ^= other.words[w];
+        return *this;
+    }
+
+    // Sets every stride-th bit in [first, size()), e.g. crossing out the
+    // multiples of a prime in a sieve. Strides shorter than a word are applied
+    // a word at a time by shifting a precomputed pattern.
+    constexpr void set_stride(size_type first, size_type stride, bool value = true) {
+        if (stride == 0) throw std::invalid_argument("Stride must be positive.");
+        if (first >= sz)
+            return;
+        if (stride < word_bits) {
+            word_type pattern = 0;
+            for (size_type b = 0; b < word_bits; b += stride)
+                pattern |= word_type(1) << b;
+            size_type offset = first % word_bits;
+            size_type carry = stride - word_bits % stride;
+            for (size_type w = first / word_bits; w < words_in_use(); ++w) {
+                if (value) words[w] |= pattern << offset; else words[w] &= ~(pattern << offset);
+                offset = (offset % stride + carry) % stride;
+            }
+            _trim();
+            return;
+        }
+        for (size_type pos = first; pos < sz; pos += stride)
+            if (value) words[pos / word_bits] |= word_type(1) << (pos % word_bits);
+            else words[pos / word_bits] &= ~(word_type(1) << (pos % word_bits));
+    }
+
+    // Queries
+    // Number of set bits
+    constexpr size_type count() const noexcept {
+        size_type total = 0;
+        for (size_type w = 0; w < words_in_use(); ++w)
+            total += std::popcount(words[w]);
+        return total;
+    }
+
+    constexpr bool all() const noexcept { return count() == sz; }
+    constexpr bool any() const noexcept { return find_first() != npos; }
+    constexpr bool none() const noexcept { return !any(); }
+
+    // Position of the first set bit, or npos
+    constexpr size_type find_first() const noexcept { return _scan_from(0); }
+
+    // Position of the first set bit after pos, or npos
+    constexpr size_type find_next(size_type pos) const noexcept { return pos + 1 >= sz ? npos : _scan_from(pos + 1); }
+
+    // Number of set bits in [0, pos)
+    constexpr size_type rank(size_type pos) const {
+        if (pos > sz) throw std::out_of_range("Index out of range.");
+        size_type total = 0;
+        for (size_type w = 0; w < pos / word_bits; ++w)
+            total += std::popcount(words[w]);
+        if (pos % word_bits)
+            total += std::popcount(words[pos / word_bits] & ((word_type(1) << (pos % word_bits)) - 1));
+        return total;
+    }
+
+    // Position of the k-th set bit (0-based), or npos if there are not that many
+    constexpr size_type select(size_type k) const noexcept {
+        for (size_type w = 0; w < words_in_use(); ++w) {
+            size_type ones = std::popcount(words[w]);
+            if (k < ones) {
+                word_type word = words[w];
+                for (size_type i = 0; i < k; ++i)
+                    word &= word - 1;
+                return w * word_bits + std::countr_zero(word);
+            }
+            k -= ones;
+        }
+        return npos;
+    }
+
+    constexpr void swap(MyBitVec& other) noexcept {
+        std::swap(words, other.words);
+        std::swap(sz, other.sz);
+    }
+
+    friend constexpr bool operator==(const MyBitVec& lhs, const MyBitVec& rhs) noexcept {
+        if (lhs.sz != rhs.sz)
+            return false;
+        for (size_type w = 0; w < lhs.words_in_use(); ++w)
+            if (lhs.words[w] != rhs.words[w])
+                return false;
+        return true;
+    }
+
+private:
+    std::array<word_type, word_count> words;
+    std::size_t sz = 0;
+
+    constexpr void _check_index(size_type pos) const {
+        if (pos >= sz) throw std::out_of_range("Index out of range.");
+    }
+
+    constexpr void _check_length(size_type new_size) const {
+        if (new_size > N) throw std::length_error("Cannot exceed preset capacity.");
+    }
+
+    constexpr void _check_same_size(const MyBitVec& other) const {
+        if (other.sz != sz) throw std::invalid_argument("Operand sizes must match.");
+    }
+
+    // Sets bits [first, last)
+    constexpr void _fill(size_type first, size_type last) {
+        for (size_type pos = first; pos < last && pos % word_bits; ++pos)
+            (*this)[pos] = true;
+        size_type pos = (first + word_bits - 1) / word_bits * word_bits;
+        for (; pos + word_bits <= last; pos += word_bits)
+            words[pos / word_bits] = ~word_type(0);
+        for (; pos < last; ++pos)
+            (*this)[pos] = true;
+    }
+
+    // Clears bits [first, last)
+    constexpr void _clear(size_type first, size_type last) {
+        for (size_type pos = first; pos < last; ++pos)
+            (*this)[pos] = false;
+    }
+
+    // Zeroes the unused bits of the last word in use
+    constexpr void _trim() {
+        if (sz % word_bits)
+            words[sz / word_bits] &= (word_type(1) << (sz % word_bits)) - 1;
+    }
+
+    constexpr size_type _scan_from(size_type pos) const noexcept {
+        if (pos >= sz)
+            return npos;
+        size_type w = pos / word_bits;
+        word_type word = words[w] & (~word_type(0) << (pos % word_bits));
+        while (true) {
+            if (word)
+                return w * word_bits + std::countr_zero(word);
+            if (++w >= words_in_use())
+                return npos;
+            word = words[w];
+        }
+    }
+};
+
+namespace std {
+template<std::size_t N>
+constexpr void swap(MyBitVec<N>& lhs, MyBitVec<N>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+}
+
+#endif  // MY_BITVEC_H_
@@ -0,0 +1,137 @@
+#ifndef MY_CONCURRENT_VECTOR_H_
+#define MY_CONCURRENT_VECTOR_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+// Append-only counterpart of MyVec that any number of threads may push to and
+// read from concurrently without locks. Storage never moves, so a pushed
+// element stays where it is for the lifetime of the vector.
+//
+// A producer claims a slot with a fetch_add on `claimed`, constructs the
+// element in place and raises the slot's ready flag. The first producer to see
+// the slot at the watermark ready advances `published` past every contiguous
+// ready slot, so readers only ever see a prefix whose elements are complete:
+//
+//     ConcurrentMyVec<Event, 4096> events;
+//     // producers
+//     if (!events.try_push_back(e)) { /* full */ }
+//     // readers
+//     for (const Event& e : events.snapshot()) ...
+//
+// Elements are never erased; clear() must not race with anything else. Slots
+// are raw storage, so T needs no default constructor. If constructing an
+// element throws, its slot and every later one stay unpublished.
+template<class T, std::size_t N>
+class ConcurrentMyVec {
+public:
+    // Member types
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const value_type&;
+    using const_pointer = const value_type*;
+    using const_iterator = const value_type*;
+
+    static constexpr size_type static_capacity = N;
+
+    // Constructors
+    // Neither copyable nor movable: producers hold on to slots by address
+    ConcurrentMyVec() : ready() {}
+    ConcurrentMyVec(const ConcurrentMyVec&) = delete;
+    ConcurrentMyVec& operator=(const ConcurrentMyVec&) = delete;
+    ~ConcurrentMyVec() { _destroy(); }
+
+    // Producers
+    // Returns false, leaving the vector unchanged, once all N slots are claimed.
+    template<class... Args>
+    bool try_emplace_back(Args&&... args) {
+        if (claimed.load(std::memory_order_relaxed) >= N)
+            return false;
+        size_type slot = claimed.fetch_add(1, std::memory_order_relaxed);
+        if (slot >= N)
+            return false;
+        std::construct_at(_data() + slot, std::forward<Args>(args)...);
+        ready[slot].store(true);
+        _publish();
+        return true;
+    }
+
+    bool try_push_back(const T& value) { return try_emplace_back(value); }
+    bool try_push_back(T&& value) { return try_emplace_back(std::move(value)); }
+
+    void push_back(const T& value) {
+        if (!try_emplace_back(value)) throw std::length_error("Cannot exceed preset capacity.");
+    }
+
+    void push_back(T&& value) {
+        if (!try_emplace_back(std::move(value))) throw std::length_error("Cannot exceed preset capacity.");
+    }
+
+    // Readers
+    // Every element before size() is complete and will not change.
+    size_type size() const noexcept { return published.load(std::memory_order_acquire); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    bool full() const noexcept { return size() == N; }
+    static constexpr size_type capacity() noexcept { return N; }
+    static constexpr size_type max_size() noexcept { return N; }
+
+    const_reference operator[](size_type pos) const { return _data()[pos]; }
+
+    const_reference at(size_type pos) const {
+        if (pos >= size()) throw std::out_of_range("Index out of range.");
+        return _data()[pos];
+    }
+
+    // The published prefix at the time of the call. Later pushes do not
+    // invalidate it, they just are not part of it.
+    std::span<const T> snapshot() const noexcept { return {_data(), size()}; }
+
+    const_iterator begin() const noexcept { return _data(); }
+    const_iterator end() const noexcept { return _data() + size(); }
+
+    // Not thread-safe
+    void clear() noexcept {
+        _destroy();
+        claimed.store(0, std::memory_order_relaxed);
+        published.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    // Slot i holds an element once ready[i] is set
+    alignas(T) std::array<std::byte, N * sizeof(T)> storage;
+    std::array<std::atomic<bool>, N> ready;
+    // Written by every producer; kept on separate cache lines so claiming a
+    // slot does not invalidate the line readers poll for the size.
+    alignas(64) std::atomic<size_type> claimed = 0;
+    alignas(64) std::atomic<size_type> published = 0;
+
+    // Advances the watermark over every ready slot. The ready flags and the
+    // watermark use sequentially consistent accesses: a producer finishing
+    // slot i + 1 while another finishes slot i must not both miss each
+    // other's flag, or the watermark would stall short of completed slots.
+    T* _data() noexcept { return reinterpret_cast<T*>(storage.data()); }
+    const T* _data() const noexcept { return reinterpret_cast<const T*>(storage.data()); }
+
+    // Destroys every constructed element, published or not, and marks its
+    // slot free
+    void _destroy() noexcept {
+        size_type used = claimed.load(std::memory_order_relaxed);
+        for (size_type i = 0; i < N && i < used; ++i)
+            if (ready[i].exchange(false, std::memory_order_relaxed))
+                std::destroy_at(_data() + i);
+    }
+
+    void _publish() noexcept {
+        size_type p = published.load();
+        while (p < N && ready[p].load())
+            if (published.compare_exchange_weak(p, p + 1))
+                ++p;
+    }
+};
+
+#endif  // MY_CONCURRENT_VECTOR_H_
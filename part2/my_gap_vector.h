@@ -0,0 +1,319 @@
+#ifndef MY_GAP_VECTOR_H_
+#define MY_GAP_VECTOR_H_
+
+#include "my_vector.h"
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Fixed-capacity vector for edits clustered around a moving cursor, as in a
+// text editor. The free capacity is kept as a gap at the cursor rather than at
+// the end:
+//
+//     [ elements before cursor | gap ... | elements after cursor ]
+//     0                        gap_begin  gap_end                N
+//
+// Inserting or erasing at the cursor only moves a gap boundary, so it is O(1).
+// Moving the cursor by d positions moves d elements across the gap, so a
+// stream of edits that drifts through the sequence costs O(total drift)
+// instead of MyVec's O(size) per edit. insert(pos, ...) and erase(pos) move
+// the cursor to pos first and leave it there.
+//
+// Elements are contiguous only on each side of the gap. segments() returns
+// both halves without moving anything; span() and data() close the gap by
+// moving the cursor to the end, after which the elements are one block.
+//
+// Iterators are indices into the logical sequence and are invalidated by any
+// operation that moves the cursor.
+template<class T, std::size_t N>
+class MyGapVec {
+    template<bool Const>
+    class _iterator;
+
+public:
+    // Member types
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using iterator = _iterator<false>;
+    using const_iterator = _iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type static_capacity = N;
+
+    // Constructors
+    // copy & move implicitly defined
+    constexpr MyGapVec() noexcept : arr() {}
+
+    constexpr MyGapVec(size_type count, const T& value) : arr() {
+        _check_length(count);
+        for (size_type i = 0; i < count; ++i)
+            arr[i] = value;
+        gap_begin = count;
+    }
+
+    template<std::input_iterator InputIt>
+    constexpr MyGapVec(InputIt first, InputIt last) : arr() {
+        for (; first != last; ++first)
+            insert_at_cursor(*first);
+    }
+
+    constexpr MyGapVec(std::initializer_list<T> init) : MyGapVec(init.begin(), init.end()) {}
+
+    constexpr explicit MyGapVec(const MyVec<T, N>& v) : MyGapVec(v.begin(), v.end()) {}
+
+    // Element access
+    constexpr reference at(size_type pos) {
+        _check_index(pos);
+        return arr[_slot(pos)];
+    }
+
+    constexpr const_reference at(size_type pos) const {
+        _check_index(pos);
+        return arr[_slot(pos)];
+    }
+
+    constexpr reference operator[](size_type pos) { return arr[_slot(pos)]; }
+    constexpr const_reference operator[](size_type pos) const { return arr[_slot(pos)]; }
+    constexpr reference front() { return (*this)[0]; }
+    constexpr const_reference front() const { return (*this)[0]; }
+    constexpr reference back() { return (*this)[size() - 1]; }
+    constexpr const_reference back() const { return (*this)[size() - 1]; }
+
+    // Closes the gap: the elements are contiguous afterwards and the cursor
+    // is at the end
+    constexpr pointer data() {
+        move_cursor(size());
+        return arr.data();
+    }
+
+    // Iterators
+    constexpr iterator begin() noexcept { return {this, 0}; }
+    constexpr iterator end() noexcept { return {this, size()}; }
+    constexpr const_iterator begin() const noexcept { return {this, 0}; }
+    constexpr const_iterator end() const noexcept { return {this, size()}; }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator cend() const noexcept { return end(); }
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+    // Views
+    // The elements before and after the cursor, in order. Loops over both
+    // halves run at the speed of loops over a MyVec.
+    constexpr std::pair<std::span<T>, std::span<T>> segments() noexcept {
+        return {{arr.data(), gap_begin}, {arr.data() + gap_end, N - gap_end}};
+    }
+
+    constexpr std::pair<std::span<const T>, std::span<const T>> segments() const noexcept {
+        return {{arr.data(), gap_begin}, {arr.data() + gap_end, N - gap_end}};
+    }
+
+    // Closes the gap, see data()
+    constexpr std::span<T> span() { return {data(), size()}; }
+
+    constexpr MyVec<T, N> to_vec() const {
+        auto [before, after] = segments();
+        MyVec<T, N> v(before.begin(), before.end());
+        v.insert(v.end(), after.begin(), after.end());
+        return v;
+    }
+
+    // Capacity
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    constexpr bool full() const noexcept { return gap_begin == gap_end; }
+    constexpr size_type size() const noexcept { return N - (gap_end - gap_begin); }
+    constexpr size_type max_size() const noexcept { return N; }
+    constexpr size_type capacity() const noexcept { return N; }
+
+    // Cursor
+    // Number of elements before the cursor, i.e. the index the next
+    // insert_at_cursor() will occupy
+    constexpr size_type cursor() const noexcept { return gap_begin; }
+
+    // Moves the cursor to pos in [0, size()], shifting the elements between
+    // the old and the new position across the gap
+    constexpr void move_cursor(size_type pos) {
+        _check_insert_index(pos);
+        T* a = arr.data();
+        if (pos < gap_begin) {
+            size_type count = gap_begin - pos;
+            std::move_backward(a + pos, a + gap_begin, a + gap_end);
+            gap_begin -= count;
+            gap_end -= count;
+        } else if (pos > gap_begin) {
+            size_type count = pos - gap_begin;
+            std::move(a + gap_end, a + gap_end + count, a + gap_begin);
+            gap_begin += count;
+            gap_end += count;
+        }
+    }
+
+    // Modifiers at the cursor, all O(1)
+    // The cursor ends up after the inserted element, as with typing
+    constexpr void insert_at_cursor(const T& value) { emplace_at_cursor(value); }
+    constexpr void insert_at_cursor(T&& value) { emplace_at_cursor(std::move(value)); }
+
+    template<class... Args>
+    constexpr reference emplace_at_cursor(Args&&... args) {
+        _check_length(size() + 1);
+        arr[gap_begin] = T(std::forward<Args>(args)...);
+        return arr[gap_begin++];
+    }
+
+    // Backspace and delete. Both require an element on that side.
+    constexpr void erase_before_cursor() noexcept { --gap_begin; }
+    constexpr void erase_after_cursor() noexcept { ++gap_end; }
+
+    // Modifiers by position
+    constexpr void clear() noexcept {
+        gap_begin = 0;
+        gap_end = N;
+    }
+
+    constexpr iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+    constexpr iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+    template<class... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args) {
+        _check_length(size() + 1);
+        move_cursor(pos.pos);
+        emplace_at_cursor(std::forward<Args>(args)...);
+        return {this, pos.pos};
+    }
+
+    constexpr iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        move_cursor(first.pos);
+        gap_end += last.pos - first.pos;
+        return {this, first.pos};
+    }
+
+    // At the back the cursor does not move, so a push_back after edits in the
+    // middle shifts the elements after the cursor by one
+    constexpr void push_back(const T& value) { emplace_back(value); }
+    constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template<class... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        if (gap_end == N)
+            return emplace_at_cursor(std::forward<Args>(args)...);
+        _check_length(size() + 1);
+        T* a = arr.data();
+        std::move(a + gap_end, a + N, a + gap_end - 1);
+        --gap_end;
+        a[N - 1] = T(std::forward<Args>(args)...);
+        return a[N - 1];
+    }
+
+    constexpr void pop_back() {
+        if (gap_end == N) {
+            --gap_begin;
+        } else {
+            T* a = arr.data();
+            std::move_backward(a + gap_end, a + N - 1, a + N);
+            ++gap_end;
+        }
+    }
+
+    constexpr void swap(MyGapVec& other) noexcept {
+        std::swap(arr, other.arr);
+        std::swap(gap_begin, other.gap_begin);
+        std::swap(gap_end, other.gap_end);
+    }
+
+private:
+    std::array<T, N> arr;
+    std::size_t gap_begin = 0;
+    std::size_t gap_end = N;
+
+    constexpr size_type _slot(size_type pos) const noexcept { return pos < gap_begin ? pos : pos + (gap_end - gap_begin); }
+
+    constexpr void _check_index(size_type pos) const {
+        if (pos >= size()) throw std::out_of_range("Index out of range.");
+    }
+
+    constexpr void _check_insert_index(size_type pos) const {
+        if (pos > size()) throw std::out_of_range("Index out of range.");
+    }
+
+    constexpr void _check_length(size_type new_size) const {
+        if (new_size > N) throw std::length_error("Cannot exceed preset capacity.");
+    }
+
+    // Random access iterator over the logical sequence, holding an index so
+    // that stepping across the gap needs no special case
+    template<bool Const>
+    class _iterator {
+        using container = std::conditional_t<Const, const MyGapVec, MyGapVec>;
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        constexpr _iterator() noexcept = default;
+        constexpr _iterator(container* v, size_type pos) noexcept : v(v), pos(pos) {}
+        constexpr _iterator(const _iterator<!Const>& other) noexcept requires Const : v(other.v), pos(other.pos) {}
+
+        constexpr reference operator*() const { return (*v)[pos]; }
+        constexpr pointer operator->() const { return &(*v)[pos]; }
+        constexpr reference operator[](difference_type n) const { return (*v)[pos + n]; }
+
+        constexpr _iterator& operator++() noexcept { ++pos; return *this; }
+        constexpr _iterator& operator--() noexcept { --pos; return *this; }
+        constexpr _iterator operator++(int) noexcept { _iterator old = *this; ++pos; return old; }
+        constexpr _iterator operator--(int) noexcept { _iterator old = *this; --pos; return old; }
+        constexpr _iterator& operator+=(difference_type n) noexcept { pos += n; return *this; }
+        constexpr _iterator& operator-=(difference_type n) noexcept { pos -= n; return *this; }
+
+        friend constexpr _iterator operator+(_iterator it, difference_type n) noexcept { return it += n; }
+        friend constexpr _iterator operator+(difference_type n, _iterator it) noexcept { return it += n; }
+        friend constexpr _iterator operator-(_iterator it, difference_type n) noexcept { return it -= n; }
+        friend constexpr difference_type operator-(const _iterator& a, const _iterator& b) noexcept {
+            return difference_type(a.pos) - difference_type(b.pos);
+        }
+        friend constexpr bool operator==(const _iterator& a, const _iterator& b) noexcept { return a.pos == b.pos; }
+        friend constexpr auto operator<=>(const _iterator& a, const _iterator& b) noexcept { return a.pos <=> b.pos; }
+
+    private:
+        friend class MyGapVec;
+        friend class _iterator<!Const>;
+
+        container* v = nullptr;
+        size_type pos = 0;
+    };
+};
+
+// Non-member functions
+template<class T, std::size_t N>
+constexpr bool operator==(const MyGapVec<T,N>& lhs, const MyGapVec<T,N>& rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class T, std::size_t N>
+constexpr void swap(MyGapVec<T,N>& lhs, MyGapVec<T,N>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif  // MY_GAP_VECTOR_H_
@@ -0,0 +1,356 @@
+#ifndef MY_MATRIX_H_
+#define MY_MATRIX_H_
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <version>
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+
+// Layouts
+// A layout maps (row, col) of an R x C matrix to an offset into its storage.
+// storage_size may exceed R * C when the layout pads.
+
+struct row_major {
+    template<std::size_t R, std::size_t C>
+    static constexpr std::size_t storage_size = R * C;
+
+    template<std::size_t R, std::size_t C>
+    static constexpr std::size_t index(std::size_t i, std::size_t j) noexcept { return i * C + j; }
+};
+
+struct col_major {
+    template<std::size_t R, std::size_t C>
+    static constexpr std::size_t storage_size = R * C;
+
+    template<std::size_t R, std::size_t C>
+    static constexpr std::size_t index(std::size_t i, std::size_t j) noexcept { return j * R + i; }
+};
+
+// B x B row-major tiles stored in row-major order, padding the last tile row
+// and column. Keeps a whole tile within a few cache lines.
+template<std::size_t B>
+struct tiled {
+    static_assert(B > 0, "Tiles must be non-empty.");
+
+    template<std::size_t R, std::size_t C>
+    static constexpr std::size_t storage_size = ((R + B - 1) / B) * ((C + B - 1) / B) * B * B;
+
+    template<std::size_t R, std::size_t C>
+    static constexpr std::size_t index(std::size_t i, std::size_t j) noexcept {
+        constexpr std::size_t tile_cols = (C + B - 1) / B;
+        return ((i / B) * tile_cols + j / B) * B * B + (i % B) * B + j % B;
+    }
+};
+
+namespace detail {
+
+// Tile edge for the cache-blocked multiply.
+inline constexpr std::size_t matrix_block = 64;
+
+// Up to this edge length, plain dot products beat the blocked multiply.
+inline constexpr std::size_t matrix_small = 32;
+
+// Tile edge for the blocked transpose. A tile writes to as many destination
+// cache lines as it has columns, so wide tiles evict their own lines from L1.
+inline constexpr std::size_t transpose_block = 8;
+
+// Up to this many bytes, source and destination share L1 and copying element
+// by element is as fast as the blocked transpose.
+inline constexpr std::size_t transpose_small_bytes = 32 * 1024;
+
+// dst = the transpose of src, both row-major, src R x C
+template<class T, std::size_t R, std::size_t C>
+void blocked_transpose(const T* src, T* dst) {
+    constexpr std::size_t B = transpose_block;
+    for (std::size_t ii = 0; ii < R; ii += B)
+        for (std::size_t jj = 0; jj < C; jj += B)
+            for (std::size_t i = ii; i < std::min(ii + B, R); ++i)
+                for (std::size_t j = jj; j < std::min(jj + B, C); ++j)
+                    dst[j * R + i] = src[i * C + j];
+}
+
+}  // namespace detail
+
+// Fixed-size R x C matrix in static storage, usable in constant evaluation.
+//
+// Multiplication and transposition fall back to the textbook loops during
+// constant evaluation; at runtime, row-major and column-major matrices use
+// cache-blocked kernels whose inner loops run over contiguous memory so they
+// can be vectorized. A column-major matrix is stored as the row-major
+// transpose, so it goes through the same kernels with the operands swapped.
+// tiled<B> matrices always use the textbook loops.
+template<class T, std::size_t R, std::size_t C, class Layout = row_major>
+class MyMatrix {
+public:
+    // Member types
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using layout_type = Layout;
+
+    static constexpr size_type static_rows = R;
+    static constexpr size_type static_cols = C;
+
+    // Constructors
+    // copy & move implicitly defined
+    constexpr MyMatrix() noexcept : arr() {}
+
+    constexpr explicit MyMatrix(const T& value) : arr() {
+        for (size_type i = 0; i < R; ++i)
+            for (size_type j = 0; j < C; ++j)
+                (*this)(i, j) = value;
+    }
+
+    // Row by row; missing trailing rows and columns are value-initialized.
+    constexpr MyMatrix(std::initializer_list<std::initializer_list<T>> rows) : arr() {
+        if (rows.size() > R) throw std::length_error("Cannot exceed preset dimensions.");
+        size_type i = 0;
+        for (const auto& row : rows) {
+            if (row.size() > C) throw std::length_error("Cannot exceed preset dimensions.");
+            size_type j = 0;
+            for (const T& value : row)
+                (*this)(i, j++) = value;
+            ++i;
+        }
+    }
+
+    static constexpr MyMatrix identity() {
+        MyMatrix m;
+        for (size_type i = 0; i < std::min(R, C); ++i)
+            m(i, i) = T(1);
+        return m;
+    }
+
+    // Element access
+    constexpr reference operator()(size_type i, size_type j) { return arr[Layout::template index<R, C>(i, j)]; }
+    constexpr const_reference operator()(size_type i, size_type j) const { return arr[Layout::template index<R, C>(i, j)]; }
+
+    constexpr reference at(size_type i, size_type j) {
+        _check_index(i, j);
+        return (*this)(i, j);
+    }
+
+    constexpr const_reference at(size_type i, size_type j) const {
+        _check_index(i, j);
+        return (*this)(i, j);
+    }
+
+    constexpr pointer data() noexcept { return arr.data(); }
+    constexpr const_pointer data() const noexcept { return arr.data(); }
+
+#if defined(__cpp_lib_mdspan)
+    // std::mdspan view for the layouts the standard library knows about
+    constexpr auto to_mdspan() noexcept requires std::same_as<Layout, row_major> || std::same_as<Layout, col_major> {
+        using L = std::conditional_t<std::same_as<Layout, row_major>, std::layout_right, std::layout_left>;
+        return std::mdspan<T, std::extents<size_type, R, C>, L>(arr.data());
+    }
+
+    constexpr auto to_mdspan() const noexcept requires std::same_as<Layout, row_major> || std::same_as<Layout, col_major> {
+        using L = std::conditional_t<std::same_as<Layout, row_major>, std::layout_right, std::layout_left>;
+        return std::mdspan<const T, std::extents<size_type, R, C>, L>(arr.data());
+    }
+#endif
+
+    // Capacity
+    static constexpr size_type rows() noexcept { return R; }
+    static constexpr size_type cols() noexcept { return C; }
+    static constexpr size_type size() noexcept { return R * C; }
+
+    // Operations
+    constexpr MyMatrix<T, C, R, Layout> transpose() const {
+        MyMatrix<T, C, R, Layout> out;
+        if (!std::is_constant_evaluated() && R * C * sizeof(T) > detail::transpose_small_bytes) {
+            if constexpr (std::same_as<Layout, row_major>) {
+                detail::blocked_transpose<T, R, C>(data(), out.data());
+                return out;
+            } else if constexpr (std::same_as<Layout, col_major>) {
+                detail::blocked_transpose<T, C, R>(data(), out.data());
+                return out;
+            }
+        }
+        for (size_type i = 0; i < R; ++i)
+            for (size_type j = 0; j < C; ++j)
+                out(j, i) = (*this)(i, j);
+        return out;
+    }
+
+    // Converts to another layout
+    template<class OtherLayout>
+    constexpr MyMatrix<T, R, C, OtherLayout> relayout() const {
+        MyMatrix<T, R, C, OtherLayout> out;
+        for (size_type i = 0; i < R; ++i)
+            for (size_type j = 0; j < C; ++j)
+                out(i, j) = (*this)(i, j);
+        return out;
+    }
+
+    friend constexpr bool operator==(const MyMatrix& lhs, const MyMatrix& rhs) {
+        for (size_type i = 0; i < R; ++i)
+            for (size_type j = 0; j < C; ++j)
+                if (!(lhs(i, j) == rhs(i, j)))
+                    return false;
+        return true;
+    }
+
+private:
+    std::array<T, Layout::template storage_size<R, C>> arr;
+
+    constexpr void _check_index(size_type i, size_type j) const {
+        if (i >= R || j >= C) throw std::out_of_range("Index out of range.");
+    }
+};
+
+namespace detail {
+
+// out = a * b over row-major storage, tiled so each B x B block of b stays in
+// cache while a row of out is updated. The innermost loop runs over
+// contiguous rows of b and out.
+template<class T, std::size_t R, std::size_t K, std::size_t C>
+void blocked_multiply(const T* a, const T* b, T* out) {
+    constexpr std::size_t B = matrix_block;
+    if constexpr (R <= matrix_small && K <= matrix_small && C <= matrix_small) {
+        // Constant trip counts this small let the compiler unroll the dot
+        // products completely; blocking would only add loop overhead. The
+        // products go to a local first: stores through out could alias a and
+        // b, and would force every element of them to be loaded again.
+        T result[R * C];
+        for (std::size_t i = 0; i < R; ++i)
+            for (std::size_t j = 0; j < C; ++j) {
+                T sum = T();
+                for (std::size_t k = 0; k < K; ++k)
+                    sum += a[i * K + k] * b[k * C + j];
+                result[i * C + j] = sum;
+            }
+        std::copy_n(result, R * C, out);
+        return;
+    }
+    std::fill_n(out, R * C, T());
+    for (std::size_t ii = 0; ii < R; ii += B)
+        for (std::size_t kk = 0; kk < K; kk += B)
+            for (std::size_t jj = 0; jj < C; jj += B) {
+                std::size_t i_end = std::min(ii + B, R);
+                std::size_t k_end = std::min(kk + B, K);
+                std::size_t j_end = std::min(jj + B, C);
+                for (std::size_t i = ii; i < i_end; ++i)
+                    for (std::size_t k = kk; k < k_end; ++k) {
+                        T aik = a[i * K + k];
+                        const T* b_row = b + k * C;
+                        T* out_row = out + i * C;
+                        for (std::size_t j = jj; j < j_end; ++j)
+                            out_row[j] += aik * b_row[j];
+                    }
+            }
+}
+
+}  // namespace detail
+
+template<class T, std::size_t R, std::size_t K, std::size_t C, class Layout>
+constexpr MyMatrix<T, R, C, Layout> operator*(const MyMatrix<T, R, K, Layout>& a, const MyMatrix<T, K, C, Layout>& b) {
+    MyMatrix<T, R, C, Layout> out;
+    if (!std::is_constant_evaluated()) {
+        if constexpr (std::same_as<Layout, row_major>) {
+            detail::blocked_multiply<T, R, K, C>(a.data(), b.data(), out.data());
+            return out;
+        } else if constexpr (std::same_as<Layout, col_major>) {
+            // out^T = b^T * a^T, each a row-major view of the column-major storage
+            detail::blocked_multiply<T, C, K, R>(b.data(), a.data(), out.data());
+            return out;
+        }
+    }
+    for (std::size_t i = 0; i < R; ++i)
+        for (std::size_t k = 0; k < K; ++k)
+            for (std::size_t j = 0; j < C; ++j)
+                out(i, j) += a(i, k) * b(k, j);
+    return out;
+}
+
+// N-dimensional counterpart of MyMatrix with row-major (last index fastest)
+// storage.
+template<class T, std::size_t... Dims>
+class MyTensor {
+    static_assert(sizeof...(Dims) > 0, "A tensor needs at least one dimension.");
+
+public:
+    // Member types
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+
+    static constexpr size_type rank = sizeof...(Dims);
+    static constexpr std::array<size_type, rank> extents = {Dims...};
+
+    // Constructors
+    // copy & move implicitly defined
+    constexpr MyTensor() noexcept : arr() {}
+
+    constexpr explicit MyTensor(const T& value) : arr() { arr.fill(value); }
+
+    // Element access
+    template<std::integral... Idx> requires (sizeof...(Idx) == rank)
+    constexpr reference operator()(Idx... idx) { return arr[_offset(idx...)]; }
+
+    template<std::integral... Idx> requires (sizeof...(Idx) == rank)
+    constexpr const_reference operator()(Idx... idx) const { return arr[_offset(idx...)]; }
+
+    template<std::integral... Idx> requires (sizeof...(Idx) == rank)
+    constexpr reference at(Idx... idx) {
+        _check_index(idx...);
+        return (*this)(idx...);
+    }
+
+    template<std::integral... Idx> requires (sizeof...(Idx) == rank)
+    constexpr const_reference at(Idx... idx) const {
+        _check_index(idx...);
+        return (*this)(idx...);
+    }
+
+    constexpr pointer data() noexcept { return arr.data(); }
+    constexpr const_pointer data() const noexcept { return arr.data(); }
+
+#if defined(__cpp_lib_mdspan)
+    constexpr auto to_mdspan() noexcept {
+        return std::mdspan<T, std::extents<size_type, Dims...>>(arr.data());
+    }
+
+    constexpr auto to_mdspan() const noexcept {
+        return std::mdspan<const T, std::extents<size_type, Dims...>>(arr.data());
+    }
+#endif
+
+    // Capacity
+    static constexpr size_type size() noexcept { return (Dims * ...); }
+
+    friend constexpr bool operator==(const MyTensor& lhs, const MyTensor& rhs) = default;
+
+private:
+    std::array<T, (Dims * ...)> arr;
+
+    template<class... Idx>
+    static constexpr size_type _offset(Idx... idx) noexcept {
+        size_type offset = 0;
+        size_type d = 0;
+        ((offset = offset * extents[d++] + size_type(idx)), ...);
+        return offset;
+    }
+
+    template<class... Idx>
+    constexpr void _check_index(Idx... idx) const {
+        size_type d = 0;
+        if (((size_type(idx) >= extents[d++]) || ...)) throw std::out_of_range("Index out of range.");
+    }
+};
+
+#endif  // MY_MATRIX_H_
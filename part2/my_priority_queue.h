@@ -0,0 +1,320 @@
+#ifndef MY_PRIORITY_QUEUE_H_
+#define MY_PRIORITY_QUEUE_H_
+
+#include "my_vector.h"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+// Fixed-capacity priority queues on MyVec storage, usable in constant
+// evaluation without the transient allocations of std::priority_queue.
+//
+// Both are D-ary heaps: the children of slot i are D * i + 1 ... D * i + D.
+// A wider node makes the heap shallower, so push does fewer comparisons and a
+// pop's sift-down touches fewer, mostly adjacent, cache lines. 4 is a good
+// default for small T.
+//
+// As with std::priority_queue, top() is the greatest element under Compare,
+// and top() and pop() require a non-empty queue.
+
+namespace detail {
+
+template<std::size_t D>
+constexpr std::size_t heap_parent(std::size_t i) noexcept { return (i - 1) / D; }
+
+template<std::size_t D>
+constexpr std::size_t heap_first_child(std::size_t i) noexcept { return D * i + 1; }
+
+}  // namespace detail
+
+template<class T, std::size_t N, class Compare = std::less<T>, std::size_t D = 4>
+class MyPriorityQueue {
+    static_assert(D >= 2, "A heap needs at least two children per node.");
+
+public:
+    // Member types
+    using container_type = MyVec<T, N>;
+    using value_compare = Compare;
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const value_type&;
+
+    static constexpr size_type static_capacity = N;
+    static constexpr size_type arity = D;
+
+    // Constructors
+    // copy & move implicitly defined
+    constexpr MyPriorityQueue() = default;
+    constexpr explicit MyPriorityQueue(const Compare& compare) : comp(compare) {}
+
+    // Heapifies [first, last) bottom-up in O(n)
+    template<std::input_iterator InputIt>
+    constexpr MyPriorityQueue(InputIt first, InputIt last, const Compare& compare = Compare())
+        : c(first, last), comp(compare) {
+        if (c.size() > 1)
+            for (size_type i = detail::heap_parent<D>(c.size() - 1) + 1; i-- > 0;)
+                _sift_down(i);
+    }
+
+    // Element access
+    constexpr const_reference top() const { return c.front(); }
+
+    // Capacity
+    [[nodiscard]] constexpr bool empty() const noexcept { return c.empty(); }
+    constexpr size_type size() const noexcept { return c.size(); }
+    constexpr size_type capacity() const noexcept { return N; }
+
+    // Modifiers
+    constexpr void push(const T& value) {
+        c.push_back(value);
+        _sift_up(c.size() - 1);
+    }
+
+    constexpr void push(T&& value) {
+        c.push_back(std::move(value));
+        _sift_up(c.size() - 1);
+    }
+
+    template<class... Args>
+    constexpr void emplace(Args&&... args) {
+        c.emplace_back(std::forward<Args>(args)...);
+        _sift_up(c.size() - 1);
+    }
+
+    // The element moved up from the back almost always belongs near the
+    // bottom again, so rather than comparing it on the way down, pop walks the
+    // hole left by top() down to a leaf along the greatest children and then
+    // sifts the back element up from there.
+    constexpr void pop() {
+        size_type n = c.size() - 1;
+        if (n == 0) {
+            c.pop_back();
+            return;
+        }
+        T* h = c.data();
+        size_type i = 0;
+        while (true) {
+            size_type first = detail::heap_first_child<D>(i);
+            if (first >= n)
+                break;
+            size_type last = first + D < n ? first + D : n;
+            size_type best = first;
+            for (size_type child = first + 1; child < last; ++child)
+                best = comp(h[best], h[child]) ? child : best;
+            h[i] = std::move(h[best]);
+            i = best;
+        }
+        h[i] = std::move(h[n]);
+        c.pop_back();
+        _sift_up(i);
+    }
+
+    constexpr void clear() noexcept { c.clear(); }
+
+private:
+    container_type c;
+    [[no_unique_address]] Compare comp;
+
+    // Both sifts move a hole instead of swapping, one move per level. They go
+    // through data() rather than operator[], which in constant evaluation is
+    // a function call per access and roughly doubles compile time.
+    constexpr void _sift_up(size_type i) {
+        T* h = c.data();
+        T value = std::move(h[i]);
+        while (i > 0) {
+            size_type parent = detail::heap_parent<D>(i);
+            if (!comp(h[parent], value))
+                break;
+            h[i] = std::move(h[parent]);
+            i = parent;
+        }
+        h[i] = std::move(value);
+    }
+
+    constexpr void _sift_down(size_type i) {
+        size_type n = c.size();
+        if (i >= n)
+            return;
+        T* h = c.data();
+        T value = std::move(h[i]);
+        while (true) {
+            size_type first = detail::heap_first_child<D>(i);
+            if (first >= n)
+                break;
+            size_type last = first + D < n ? first + D : n;
+            size_type best = first;
+            for (size_type child = first + 1; child < last; ++child)
+                best = comp(h[best], h[child]) ? child : best;
+            if (!comp(value, h[best]))
+                break;
+            h[i] = std::move(h[best]);
+            i = best;
+        }
+        h[i] = std::move(value);
+    }
+};
+
+// Priority queue over the keys 0 ... N - 1, each present at most once with a
+// priority of type T. Tracking where every key sits in the heap allows its
+// priority to be changed in O(log n), which Dijkstra and Prim need:
+//
+//     MyIndexedPriorityQueue<int, V, std::greater<int>> q;  // min-queue
+//     q.push(source, 0);
+//     while (!q.empty()) {
+//         auto [u, d] = q.top(); q.pop();
+//         for (auto [v, w] : adj[u])
+//             if (d + w < dist[v]) { dist[v] = d + w; q.push_or_update(v, dist[v]); }
+//     }
+template<class T, std::size_t N, class Compare = std::less<T>, std::size_t D = 4>
+class MyIndexedPriorityQueue {
+    static_assert(D >= 2, "A heap needs at least two children per node.");
+
+public:
+    // Member types
+    using value_compare = Compare;
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type static_capacity = N;
+    static constexpr size_type arity = D;
+    static constexpr size_type npos = size_type(-1);
+
+    // Constructors
+    // copy & move implicitly defined
+    constexpr MyIndexedPriorityQueue() : MyIndexedPriorityQueue(Compare()) {}
+
+    constexpr explicit MyIndexedPriorityQueue(const Compare& compare) : prio(), comp(compare) {
+        for (size_type k = 0; k < N; ++k)
+            pos[k] = npos;
+    }
+
+    // Element access
+    // The key with the greatest priority, and that priority
+    constexpr std::pair<size_type, T> top() const { return {heap[0], prio[heap[0]]}; }
+    constexpr size_type top_key() const { return heap[0]; }
+
+    constexpr bool contains(size_type key) const {
+        _check_key(key);
+        return pos[key] != npos;
+    }
+
+    constexpr const T& priority(size_type key) const {
+        _check_present(key);
+        return prio[key];
+    }
+
+    // Capacity
+    [[nodiscard]] constexpr bool empty() const noexcept { return heap.empty(); }
+    constexpr size_type size() const noexcept { return heap.size(); }
+    constexpr size_type capacity() const noexcept { return N; }
+
+    // Modifiers
+    constexpr void push(size_type key, const T& priority) {
+        _check_key(key);
+        if (pos[key] != npos) throw std::invalid_argument("Key already present.");
+        prio[key] = priority;
+        pos[key] = heap.size();
+        heap.push_back(key);
+        _sift_up(heap.size() - 1);
+    }
+
+    // Sets the priority of a present key, moving it up or down as needed.
+    // Covers decrease-key (and increase-key) whichever way Compare orders.
+    constexpr void update(size_type key, const T& priority) {
+        _check_present(key);
+        bool raised = comp(prio[key], priority);
+        prio[key] = priority;
+        if (raised)
+            _sift_up(pos[key]);
+        else
+            _sift_down(pos[key]);
+    }
+
+    constexpr void push_or_update(size_type key, const T& priority) {
+        if (contains(key))
+            update(key, priority);
+        else
+            push(key, priority);
+    }
+
+    constexpr void pop() { erase(heap[0]); }
+
+    constexpr void erase(size_type key) {
+        _check_present(key);
+        size_type i = pos[key];
+        pos[key] = npos;
+        size_type last = heap.back();
+        heap.pop_back();
+        if (i == heap.size())
+            return;
+        heap[i] = last;
+        pos[last] = i;
+        _sift_up(i);
+        _sift_down(pos[last]);
+    }
+
+    constexpr void clear() {
+        for (size_type key : heap)
+            pos[key] = npos;
+        heap.clear();
+    }
+
+private:
+    MyVec<size_type, N> heap;          // keys in heap order
+    std::array<size_type, N> pos;      // slot of each key in heap, or npos
+    std::array<T, N> prio;             // priority of each key
+    [[no_unique_address]] Compare comp;
+
+    constexpr void _check_key(size_type key) const {
+        if (key >= N) throw std::out_of_range("Index out of range.");
+    }
+
+    constexpr void _check_present(size_type key) const {
+        _check_key(key);
+        if (pos[key] == npos) throw std::invalid_argument("Key not present.");
+    }
+
+    constexpr void _place(size_type i, size_type key) {
+        heap.data()[i] = key;
+        pos[key] = i;
+    }
+
+    constexpr void _sift_up(size_type i) {
+        const size_type* h = heap.data();
+        size_type key = h[i];
+        while (i > 0) {
+            size_type parent = detail::heap_parent<D>(i);
+            if (!comp(prio[h[parent]], prio[key]))
+                break;
+            _place(i, h[parent]);
+            i = parent;
+        }
+        _place(i, key);
+    }
+
+    constexpr void _sift_down(size_type i) {
+        size_type n = heap.size();
+        const size_type* h = heap.data();
+        size_type key = h[i];
+        while (true) {
+            size_type first = detail::heap_first_child<D>(i);
+            if (first >= n)
+                break;
+            size_type last = first + D < n ? first + D : n;
+            size_type best = first;
+            for (size_type child = first + 1; child < last; ++child)
+                if (comp(prio[h[best]], prio[h[child]]))
+                    best = child;
+            if (!comp(prio[key], prio[h[best]]))
+                break;
+            _place(i, h[best]);
+            i = best;
+        }
+        _place(i, key);
+    }
+};
+
+#endif  // MY_PRIORITY_QUEUE_H_
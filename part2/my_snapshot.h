@@ -0,0 +1,293 @@
+#ifndef MY_SNAPSHOT_H_
+#define MY_SNAPSHOT_H_
+
+#include "my_vector.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Binary snapshots of a MyVec<T, N> of trivially copyable T, written once and
+// mapped read-only by any number of processes:
+//
+//     write_snapshot("table.snap", table);         // MyVec<int, 4096>
+//     MyVecView<int> view("table.snap");           // no copy, O(1) in size
+//     int x = view[42];
+//
+// The file is a SnapshotHeader followed by the payload, the size() elements
+// in use as raw bytes, starting at a multiple of snapshot_alignment. Opening
+// a view checks the header and that the file is long enough; the checksum
+// over the payload is only checked by verify(), so that opening does not
+// touch every page. Snapshots are not portable between machines with
+// different byte orders or type layouts, and opening one that is would throw.
+// POSIX only.
+
+// Thrown when a file is not a snapshot of the expected type
+class SnapshotError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+inline constexpr std::uint32_t snapshot_version = 1;
+inline constexpr std::size_t snapshot_alignment = 64;
+
+// Identifies the element type in the header. The default distinguishes
+// signed, unsigned, floating point and other types by size and alignment;
+// specialize it to tell apart structs of the same shape:
+//
+//     template<> inline constexpr std::uint64_t snapshot_type_tag<Point> = 0x506f696e74;
+template<class T>
+inline constexpr std::uint64_t snapshot_type_tag =
+    (std::uint64_t(std::is_floating_point_v<T> ? 3 : std::is_signed_v<T> ? 2 : std::is_integral_v<T> ? 1 : 0) << 56)
+    | (std::uint64_t(alignof(T)) << 32) | std::uint64_t(sizeof(T));
+
+struct SnapshotHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;       // byte_order_mark as written
+    std::uint64_t type_tag;
+    std::uint64_t element_size;
+    std::uint64_t capacity;         // N of the MyVec written
+    std::uint64_t size;
+    std::uint64_t payload_offset;   // from the start of the file
+    std::uint64_t checksum;         // snapshot_checksum of the payload
+
+    static constexpr char expected_magic[8] = {'M', 'Y', 'V', 'E', 'C', 'S', 'N', 'P'};
+    static constexpr std::uint32_t byte_order_mark = 0x01020304;
+};
+
+// FNV-1a over the payload bytes
+constexpr std::uint64_t snapshot_checksum(const unsigned char* bytes, std::size_t count) noexcept {
+    std::uint64_t h = 0xcbf29ce484222325;
+    for (std::size_t i = 0; i < count; ++i)
+        h = (h ^ bytes[i]) * 0x100000001b3;
+    return h;
+}
+
+namespace detail {
+
+// Writes all `count` bytes, resuming after short writes and interruptions.
+// On failure returns false with errno set.
+inline bool write_all(int fd, const void* bytes, std::size_t count) {
+    const char* p = static_cast<const char*>(bytes);
+    while (count > 0) {
+        ssize_t written = write(fd, p, count);
+        if (written == -1) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        p += written;
+        count -= std::size_t(written);
+    }
+    return true;
+}
+
+}  // namespace detail
+
+// Writes `v` to `path`. The snapshot goes to a temporary file, which is
+// flushed to disk with fsync and then renamed over `path`: readers never see
+// a partly written snapshot, and a crash leaves either the old one or the
+// new one. On failure the temporary file is removed and `path` is untouched.
+template<class T, std::size_t N>
+void write_snapshot(const std::string& path, const MyVec<T, N>& v) {
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshot elements must be trivially copyable.");
+    const auto* payload = reinterpret_cast<const unsigned char*>(v.data());
+    std::size_t payload_bytes = v.size() * sizeof(T);
+
+    SnapshotHeader header = {};
+    std::memcpy(header.magic, SnapshotHeader::expected_magic, sizeof(header.magic));
+    header.version = snapshot_version;
+    header.byte_order = SnapshotHeader::byte_order_mark;
+    header.type_tag = snapshot_type_tag<T>;
+    header.element_size = sizeof(T);
+    header.capacity = N;
+    header.size = v.size();
+    header.payload_offset = (sizeof(SnapshotHeader) + snapshot_alignment - 1) / snapshot_alignment * snapshot_alignment;
+    header.checksum = snapshot_checksum(payload, payload_bytes);
+
+    std::string tmp = path + ".tmp";
+    auto fail = [&](int err, const std::string& what) {
+        std::remove(tmp.c_str());
+        throw std::system_error(err, std::generic_category(), what);
+    };
+    int fd = open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1)
+        throw std::system_error(errno, std::generic_category(), tmp + ": cannot create the snapshot");
+    char padding[snapshot_alignment] = {};
+    if (!detail::write_all(fd, &header, sizeof(header))
+        || !detail::write_all(fd, padding, header.payload_offset - sizeof(header))
+        || !detail::write_all(fd, payload, payload_bytes) || fsync(fd) == -1) {
+        int err = errno;
+        close(fd);
+        fail(err, tmp + ": cannot write the snapshot");
+    }
+    if (close(fd) == -1)
+        fail(errno, tmp + ": cannot write the snapshot");
+    if (std::rename(tmp.c_str(), path.c_str()) != 0)
+        fail(errno, path + ": cannot replace it with the snapshot");
+}
+
+// Read-only view of a snapshot, mapped into memory. Offers the const part of
+// the Vector interface over the elements; nothing is copied, and pages are
+// only read from the file when first touched. Move-only.
+template<class T>
+class MyVecView {
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshot elements must be trivially copyable.");
+
+public:
+    // Member types
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+    using pointer = const value_type*;
+    using const_pointer = const value_type*;
+    using iterator = const value_type*;
+    using const_iterator = const value_type*;
+    using reverse_iterator = std::reverse_iterator<const_iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    explicit MyVecView(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw std::system_error(errno, std::generic_category(), path);
+        struct stat st;
+        if (fstat(fd, &st) == -1) {
+            int err = errno;
+            close(fd);
+            throw std::system_error(err, std::generic_category(), path);
+        }
+        map_bytes = static_cast<std::size_t>(st.st_size);
+        if (map_bytes < sizeof(SnapshotHeader)) {
+            close(fd);
+            throw SnapshotError(path + ": too short for a snapshot header");
+        }
+        void* p = mmap(nullptr, map_bytes, PROT_READ, MAP_SHARED, fd, 0);
+        int err = errno;
+        close(fd);
+        if (p == MAP_FAILED)
+            throw std::system_error(err, std::generic_category(), path);
+        map = p;
+        try {
+            _check_header(path);
+        } catch (...) {
+            munmap(map, map_bytes);
+            throw;
+        }
+    }
+
+    MyVecView(MyVecView&& other) noexcept
+        : map(std::exchange(other.map, nullptr)), map_bytes(std::exchange(other.map_bytes, 0)),
+          elems(std::exchange(other.elems, nullptr)), sz(std::exchange(other.sz, 0)),
+          cap(std::exchange(other.cap, 0)) {}
+
+    MyVecView& operator=(MyVecView&& other) noexcept {
+        std::swap(map, other.map);
+        std::swap(map_bytes, other.map_bytes);
+        std::swap(elems, other.elems);
+        std::swap(sz, other.sz);
+        std::swap(cap, other.cap);
+        return *this;
+    }
+
+    ~MyVecView() {
+        if (map)
+            munmap(map, map_bytes);
+    }
+
+    // Element access
+    const_reference at(size_type pos) const {
+        if (pos >= sz) throw std::out_of_range("Index out of range.");
+        return elems[pos];
+    }
+
+    const_reference operator[](size_type pos) const { return elems[pos]; }
+    const_reference front() const { return elems[0]; }
+    const_reference back() const { return elems[sz - 1]; }
+    const_pointer data() const noexcept { return elems; }
+    std::span<const T> span() const noexcept { return {elems, sz}; }
+
+    // Iterators
+    const_iterator begin() const noexcept { return elems; }
+    const_iterator end() const noexcept { return elems + sz; }
+    const_iterator cbegin() const noexcept { return elems; }
+    const_iterator cend() const noexcept { return elems + sz; }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    // Capacity
+    // capacity() is the N of the MyVec that was written
+    [[nodiscard]] bool empty() const noexcept { return sz == 0; }
+    size_type size() const noexcept { return sz; }
+    size_type max_size() const noexcept { return cap; }
+    size_type capacity() const noexcept { return cap; }
+
+    // Reads the whole payload and compares it against the header's checksum
+    bool verify() const noexcept {
+        const auto& header = *static_cast<const SnapshotHeader*>(map);
+        return snapshot_checksum(reinterpret_cast<const unsigned char*>(elems), sz * sizeof(T)) == header.checksum;
+    }
+
+    // Copies the elements into a MyVec, which must have room for them
+    template<std::size_t N>
+    MyVec<T, N> to_vec() const { return MyVec<T, N>(begin(), end()); }
+
+private:
+    void* map = nullptr;
+    std::size_t map_bytes = 0;
+    const T* elems = nullptr;
+    std::size_t sz = 0;
+    std::size_t cap = 0;
+
+    void _check_header(const std::string& path) {
+        SnapshotHeader header;
+        std::memcpy(&header, map, sizeof(header));
+        if (std::memcmp(header.magic, SnapshotHeader::expected_magic, sizeof(header.magic)) != 0)
+            throw SnapshotError(path + ": not a snapshot");
+        if (header.version != snapshot_version)
+            throw SnapshotError(path + ": unsupported snapshot version " + std::to_string(header.version));
+        if (header.byte_order != SnapshotHeader::byte_order_mark)
+            throw SnapshotError(path + ": snapshot written with a different byte order");
+        if (header.type_tag != snapshot_type_tag<T> || header.element_size != sizeof(T))
+            throw SnapshotError(path + ": snapshot of a different element type");
+        if (header.size > header.capacity)
+            throw SnapshotError(path + ": snapshot size exceeds its capacity");
+        if (header.payload_offset % alignof(T) != 0 || header.payload_offset > map_bytes
+            || header.size > (map_bytes - header.payload_offset) / sizeof(T))
+            throw SnapshotError(path + ": snapshot truncated or malformed");
+        elems = reinterpret_cast<const T*>(static_cast<const unsigned char*>(map) + header.payload_offset);
+        sz = header.size;
+        cap = header.capacity;
+    }
+};
+
+template<class T>
+bool operator==(const MyVecView<T>& lhs, const MyVecView<T>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<class T, std::size_t N>
+bool operator==(const MyVecView<T>& lhs, const MyVec<T, N>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+#endif  // MY_SNAPSHOT_H_
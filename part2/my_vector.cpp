@@ -1,5 +1,6 @@
 #include "my_vector.h"
 #include "vec_concepts.h"
+#include "vec_algorithms.h"
 
 #include <iostream>
 #include <vector>
@@ -21,8 +22,7 @@ constexpr Vec populate() {
 
 template<Vector Vec>
 constexpr Vec prefix_sum(Vec v){
-    for (int i = 1; i < v.size(); ++i)
-        v[i] += v[i - 1];
+    inclusive_scan(v);
     return v;
 }
 
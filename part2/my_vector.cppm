@@ -0,0 +1,42 @@
+// Module interface for MyVec and the Vector concepts:
+//
+//     import my_vector;
+//     MyVec<int, 8> v = {1, 2, 3};
+//
+// Importers skip parsing my_vector.h, vec_concepts.h and the standard headers
+// behind them; the compiler loads the prebuilt module instead. With GCC:
+//
+//     g++ -std=c++20 -fmodules-ts -x c++ -c my_vector.cppm
+//     g++ -std=c++20 -fmodules-ts main.cpp my_vector.o
+//
+// The headers remain the primary interface; this file only re-exports them.
+module;
+
+// The standard headers go in the global module fragment. Their include guards
+// then keep them out of the module purview below.
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iosfwd>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+export module my_vector;
+
+// extern "C++" attaches the declarations to the global module, so a program
+// may mix TUs that import the module with TUs that include the headers.
+export extern "C++" {
+#include "my_vector.h"
+#include "vec_concepts.h"
+}
@@ -1,15 +1,51 @@
 #ifndef MY_VECTOR_H_
 #define MY_VECTOR_H_
 
-#include <iostream>
-#include <concepts>
-#include <type_traits>
-#include <vector>
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iosfwd>
+#include <iterator>
+#include <span>
 #include <stdexcept>
+#include <string_view>
+#include <type_traits>
 #include <utility>
-#include <format>
-#include <iterator>
-#include <concepts>
+
+// Operation counters, collected when MYVEC_STATS is defined before including
+// this header. Every translation unit of a program must agree on the setting.
+//
+//     MyVec<int, 64> v = ...;
+//     std::cout << v.stats();                       // at runtime
+//     static_assert(vec_stats(make()).longest_shift < 8);  // at compile time
+//
+// Counters live in the instance, so copies carry them along. Checks reached
+// through const member functions are not counted: a mutable counter would
+// make constexpr MyVecs uncopyable in constant evaluation.
+struct VecStats {
+    bool enabled = false;
+    std::size_t capacity = 0;
+    std::size_t high_water = 0;     // largest size() reached
+    std::size_t shifts = 0;         // inserts and erases that moved elements
+    std::size_t shifted = 0;        // elements moved by them
+    std::size_t longest_shift = 0;  // most elements moved by one of them
+    std::size_t copies = 0;         // element writes, including shifted ones
+    std::size_t failed_checks = 0;  // length and index checks that threw
+
+    // A template so that only code printing stats needs <ostream>
+    template<class CharT, class Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const VecStats& s) {
+        if (!s.enabled)
+            return os << "MyVec stats disabled (define MYVEC_STATS)\n";
+        return os << "high water:    " << s.high_water << " / " << s.capacity << '\n'
+                  << "shifts:        " << s.shifts << " (" << s.shifted << " elements, longest " << s.longest_shift << ")\n"
+                  << "copies:        " << s.copies << '\n'
+                  << "failed checks: " << s.failed_checks << '\n';
+    }
+};
 
 // No allocator since we are using static memory only
 template <class T, std::size_t N>
@@ -28,6 +64,9 @@ public:
     using reverse_iterator = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
+    // Capacity known at compile time, see FixedCapacityVector
+    static constexpr size_type static_capacity = N;
+
     // Constructors
     // copy & move implicitly defined
     constexpr MyVec() noexcept : arr() {}
@@ -37,6 +76,7 @@ public:
         for (size_type i = 0; i < count; ++i)
             arr[i] = value;
         sz = count;
+        _record_writes(count);
     }
 
     constexpr explicit MyVec(size_type count) : arr() {
@@ -44,16 +84,18 @@ public:
         for (size_type i = 0; i < count; ++i)
             arr[i] = T();
         sz = count;
+        _record_writes(count);
     }
 
     template<std::input_iterator InputIt>
-    constexpr MyVec(InputIt first, InputIt last) { insert(0, first, last); }
+    constexpr MyVec(InputIt first, InputIt last) : arr() { insert(begin(), first, last); }
 
-    constexpr MyVec(std::initializer_list<T> init) {
+    constexpr MyVec(std::initializer_list<T> init) : arr() {
         sz = init.size();
         int i = 0;
         for (auto it = init.begin(); it != init.end(); ++it)
             arr[i++] = *it;
+        _record_writes(sz);
     }
 
     // Assign
@@ -82,7 +124,7 @@ public:
     constexpr reference back() { return arr[sz - 1]; }
     constexpr const_reference back() const { return arr[sz - 1]; }
     constexpr pointer data() noexcept { return arr.data(); }
-    constexpr const pointer data() const noexcept { return arr.data(); }
+    constexpr const_pointer data() const noexcept { return arr.data(); }
 
 
     // Iterators
@@ -99,6 +141,55 @@ public:
     constexpr const_reverse_iterator crbegin() const noexcept { return arr.crend() - sz; }
     constexpr const_reverse_iterator crend() const noexcept { return arr.crend(); }
 
+    // Views
+    // Zero-copy views of the elements. The fixed-extent ones carry their size
+    // in the type, so kernels taking std::span<T, K> see a compile-time bound.
+    // The extent must fit in the capacity at compile time and in size() at runtime.
+    constexpr std::span<T> span() noexcept { return {arr.data(), sz}; }
+    constexpr std::span<const T> span() const noexcept { return {arr.data(), sz}; }
+
+    template<size_type K>
+    constexpr std::span<T, K> first() {
+        static_assert(K <= N, "Extent exceeds capacity.");
+        _check_view(0, K);
+        return std::span<T, K>(arr.data(), K);
+    }
+
+    template<size_type K>
+    constexpr std::span<const T, K> first() const {
+        static_assert(K <= N, "Extent exceeds capacity.");
+        _check_view(0, K);
+        return std::span<const T, K>(arr.data(), K);
+    }
+
+    template<size_type K>
+    constexpr std::span<T, K> last() {
+        static_assert(K <= N, "Extent exceeds capacity.");
+        _check_view(0, K);
+        return std::span<T, K>(arr.data() + sz - K, K);
+    }
+
+    template<size_type K>
+    constexpr std::span<const T, K> last() const {
+        static_assert(K <= N, "Extent exceeds capacity.");
+        _check_view(0, K);
+        return std::span<const T, K>(arr.data() + sz - K, K);
+    }
+
+    template<size_type Offset, size_type K>
+    constexpr std::span<T, K> subspan() {
+        static_assert(Offset + K <= N, "Extent exceeds capacity.");
+        _check_view(Offset, K);
+        return std::span<T, K>(arr.data() + Offset, K);
+    }
+
+    template<size_type Offset, size_type K>
+    constexpr std::span<const T, K> subspan() const {
+        static_assert(Offset + K <= N, "Extent exceeds capacity.");
+        _check_view(Offset, K);
+        return std::span<const T, K>(arr.data() + Offset, K);
+    }
+
     // Capacity
     // Not implemented: reserve()
     [[nodiscard]] constexpr bool empty() const noexcept { return sz == 0; }
@@ -114,6 +205,7 @@ public:
         _shift_n_forward(pos_idx, 1);
         ++sz;
         arr[pos_idx] = value;
+        _record_writes(1);
         return begin() + pos_idx;
     }
 
@@ -123,6 +215,7 @@ public:
         _shift_n_forward(pos_idx, 1);
         ++sz;
         arr[pos_idx] = value;
+        _record_writes(1);
         return begin() + pos_idx;
     }
 
@@ -133,6 +226,7 @@ public:
         sz += count;
         for (size_type i = 0; i < count; ++i)
             arr[pos_idx + i] = value;
+        _record_writes(count);
         return begin() + pos_idx;
     }
 
@@ -148,6 +242,7 @@ public:
         int i = 0;
         for (InputIt it = first; it != last; ++it, ++i)
             arr[pos_idx + i] = *it;
+        _record_writes(count);
         return begin() + pos_idx;
     }
 
@@ -160,6 +255,7 @@ public:
         size_type i = 0;
         for (auto it = ilist.begin(); it != ilist.end(); ++it, ++i)
             arr[pos_idx + i] = *it;
+        _record_writes(count);
         return begin() + pos_idx;
     }
 
@@ -170,6 +266,7 @@ public:
         _shift_n_forward(pos_idx, 1);
         ++sz;
         arr[pos_idx] = T(std::forward<Args>(args)...);
+        _record_writes(1);
         return begin() + pos_idx;
     }
 
@@ -195,6 +292,7 @@ public:
     constexpr reference emplace_back(Args&&... args) {
         _check_length(sz + 1);
         arr[sz++] = T(std::forward<Args>(args)...);
+        _record_writes(1);
         return arr[sz];
     }
 
@@ -205,7 +303,9 @@ public:
         if (sz < count)
             for (size_type i = sz; i < count; ++i)
                 arr[i] = T();
-        sz = count;    
+        size_type grown = count > sz ? count - sz : 0;
+        sz = count;
+        _record_writes(grown);
     }
 
     constexpr void resize(size_type count, const value_type& value) {
@@ -213,37 +313,101 @@ public:
         if (sz < count)
             for (size_type i = sz; i < count; ++i)
                 arr[i] = value;
+        size_type grown = count > sz ? count - sz : 0;
         sz = count;
+        _record_writes(grown);
     }
 
     constexpr void swap(MyVec<T, N>& other) noexcept {
         std::swap(arr, other.arr);
         std::swap(sz, other.sz);
+#ifdef MYVEC_STATS
+        std::swap(_stats, other._stats);
+#endif
+    }
+
+    // Counters collected under MYVEC_STATS, see VecStats
+    constexpr VecStats stats() const noexcept {
+#ifdef MYVEC_STATS
+        VecStats s = _stats;
+        s.enabled = true;
+        s.capacity = N;
+        s.high_water = std::max(s.high_water, sz);
+        return s;
+#else
+        return VecStats{};
+#endif
     }
 
 private:
     std::array<T, N> arr;
     std::size_t sz = 0;
     std::size_t cap = N;
+#ifdef MYVEC_STATS
+    VecStats _stats;
+#endif
 
-    constexpr void _check_index(size_type pos) {
+    constexpr void _check_index(size_type pos) const {
         if (pos < 0 || pos >= sz) throw std::out_of_range("Index out of range.");
     }
 
+    constexpr void _check_index(size_type pos) {
+        if (pos >= sz) _record_failed_check();
+        std::as_const(*this)._check_index(pos);
+    }
+
     constexpr void _check_insert_index(size_type pos) {
-        if (pos < 0 || pos > sz) throw std::out_of_range("Index out of range.");
+        if (pos < 0 || pos > sz) {
+            _record_failed_check();
+            throw std::out_of_range("Index out of range.");
+        }
+    }
+
+    constexpr void _check_view(size_type offset, size_type count) const {
+        if (offset + count > sz) throw std::out_of_range("View out of range.");
     }
 
     constexpr void _check_length(size_type new_size) {
-        if (new_size > cap) throw std::length_error("Cannot exceed preset capacity.");
+        if (new_size > cap) {
+            _record_failed_check();
+            throw std::length_error("Cannot exceed preset capacity.");
+        }
     }
 
     constexpr void _shift_n_forward(size_type pos, size_type n) {
         for (int i = int(sz) - 1; i >= int(pos); --i) arr[i + n] = arr[i];
+        _record_shift(pos < sz ? sz - pos : 0);
     }
 
     constexpr void _shift_n_backward(size_type pos, size_type n) {
         for (int i = pos + n; i < sz; ++i) arr[i - n] = arr[i];
+        _record_shift(pos + n < sz ? sz - pos - n : 0);
+    }
+
+    // Stats hooks, no-ops unless MYVEC_STATS is defined. Called after the
+    // operation so the high water mark sees the new size.
+    constexpr void _record_writes([[maybe_unused]] size_type count) {
+#ifdef MYVEC_STATS
+        _stats.copies += count;
+        _stats.high_water = std::max(_stats.high_water, sz);
+#endif
+    }
+
+    constexpr void _record_shift([[maybe_unused]] size_type moved) {
+#ifdef MYVEC_STATS
+        if (moved == 0)
+            return;
+        ++_stats.shifts;
+        _stats.shifted += moved;
+        _stats.longest_shift = std::max(_stats.longest_shift, moved);
+        _stats.copies += moved;
+#endif
+    }
+
+    constexpr void _record_failed_check() {
+#ifdef MYVEC_STATS
+        ++_stats.failed_checks;
+#endif
     }
 
     constexpr void _insert_check(size_type pos, size_type count) {
@@ -252,10 +416,51 @@ private:
     }
 };
 
+namespace detail {
+
+// Element types for which == is equality of the object representation: no
+// padding bits, no values such as -0.0 or NaN whose comparison disagrees with
+// their bytes, and no user-defined == that may ignore some of them. Runs of
+// them are compared and hashed as raw memory.
+template<class T>
+inline constexpr bool bytewise_equal = std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+// Those whose ordering is also the one memcmp gives, i.e. unsigned bytes.
+template<class T>
+inline constexpr bool bytewise_ordered = std::is_same_v<T, unsigned char> || std::is_same_v<T, std::byte>
+                                      || std::is_same_v<T, char8_t> || (std::is_same_v<T, char> && std::is_unsigned_v<char>);
+
+// Bytes skipped per memcmp while looking for the first difference
+inline constexpr std::size_t compare_block = 256;
+
+}  // namespace detail
+
 // Non-member functions
 // Not implemented: erase, erase_if
+//
+// At runtime, comparisons of bytewise_equal elements go through memcmp, which
+// the library implements with vector instructions.
 template<class T, std::size_t N>
 constexpr auto operator<=>(const MyVec<T,N>& lhs, const MyVec<T,N>& rhs) {
+    if constexpr (detail::bytewise_ordered<T>) {
+        if (!std::is_constant_evaluated()) {
+            std::size_t n = std::min(lhs.size(), rhs.size());
+            if (int r = std::memcmp(lhs.data(), rhs.data(), n * sizeof(T)); r != 0)
+                return r <=> 0;
+            return lhs.size() <=> rhs.size();
+        }
+    } else if constexpr (detail::bytewise_equal<T>) {
+        if (!std::is_constant_evaluated()) {
+            // Skip the common prefix a block at a time, then compare element
+            // by element from the block holding the first difference.
+            constexpr std::size_t block = std::max<std::size_t>(1, detail::compare_block / sizeof(T));
+            std::size_t n = std::min(lhs.size(), rhs.size());
+            std::size_t i = 0;
+            while (i + block <= n && std::memcmp(lhs.data() + i, rhs.data() + i, block * sizeof(T)) == 0)
+                i += block;
+            return std::lexicographical_compare_three_way(lhs.begin() + i, lhs.end(), rhs.begin() + i, rhs.end());
+        }
+    }
     return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
@@ -263,17 +468,45 @@ template<class T, std::size_t N>
 constexpr bool operator==(const MyVec<T,N>& lhs, const MyVec<T,N>& rhs) {
     if (lhs.size() != rhs.size())
         return false;
-    for (int i = 0; i < lhs.size(); ++i)
+    if constexpr (detail::bytewise_equal<T>)
+        if (!std::is_constant_evaluated())
+            return std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0;
+    for (std::size_t i = 0; i < lhs.size(); ++i)
         if (lhs[i] != rhs[i])
             return false;
     return true;
 }
 
+// Reads the counters of a MyVec built during constant evaluation:
+//     static_assert(vec_stats(build()).high_water <= 16);
+template<class T, std::size_t N>
+consteval VecStats vec_stats(const MyVec<T, N>& v) {
+    return v.stats();
+}
+
 namespace std {
 template<class T, std::size_t N>
 constexpr void swap(MyVec<T,N>& lhs, MyVec<T,N>& rhs) noexcept {
     lhs.swap(rhs);
 }
+
+// Hashes the size() elements in use, never the unused capacity. Runs of
+// bytewise_equal elements are hashed as one block of bytes; anything else
+// combines the element hashes.
+template<class T, std::size_t N>
+struct hash<MyVec<T, N>> {
+    std::size_t operator()(const MyVec<T, N>& v) const noexcept {
+        if constexpr (::detail::bytewise_equal<T>) {
+            std::string_view bytes(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+            return std::hash<std::string_view>()(bytes);
+        } else {
+            std::size_t h = v.size();
+            for (const T& x : v)
+                h ^= std::hash<T>()(x) + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+            return h;
+        }
+    }
+};
 }
 
 #endif  // MY_VECTOR_H_
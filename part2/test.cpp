@@ -1,5 +1,17 @@
 #include "my_vector.h"
 #include "vec_concepts.h"
+#include "vec_algorithms.h"
+#include "vec_range_query.h"
+#include "vec_expr.h"
+#include "vec_views.h"
+#include "my_matrix.h"
+#include "my_bitvec.h"
+#include "my_concurrent_vector.h"
+#include "my_arena.h"
+#include "my_priority_queue.h"
+#include "my_gap_vector.h"
+#include "my_snapshot.h"
+#include "vec_emit.h"
 
 #include <iostream>
 #include <vector>
@@ -8,6 +20,15 @@
 #include <algorithm>
 #include <exception>
 #include <cassert>
+#include <memory>
+#include <sstream>
+#include <atomic>
+#include <thread>
+#include <queue>
+#include <unordered_set>
+#include <filesystem>
+#include <fstream>
+#include <cstddef>
 
 void test_emplace_back_1() {
     MyVec<int, 10> v;
@@ -336,6 +357,1118 @@ constexpr void test_concept_4() {
     // static_assert(Vector<std::vector<void>>);
 }
 
+constexpr void test_scan_1() {
+    constexpr MyVec<int, 10> v = [] {
+        MyVec<int, 10> v = {1, 2, 3, 4};
+        inclusive_scan(v);
+        return v;
+    }();
+    static_assert(v == MyVec<int, 10>({1, 3, 6, 10}));
+
+    constexpr MyVec<int, 10> w = [] {
+        MyVec<int, 10> w = {1, 2, 3, 4};
+        exclusive_scan(w, 1, std::multiplies<>{});
+        return w;
+    }();
+    static_assert(w == MyVec<int, 10>({1, 1, 2, 6}));
+
+    constexpr MyVec<int, 10> s = [] {
+        MyVec<int, 10> s = {1, 1, 1, 1, 1, 1};
+        MyVec<bool, 10> heads = {true, false, true, false, false, true};
+        segmented_inclusive_scan(s, heads);
+        return s;
+    }();
+    static_assert(s == MyVec<int, 10>({1, 2, 1, 2, 3, 1}));
+}
+
+void test_scan_2() {
+    // Non-commutative operator
+    using SVec = MyVec<std::string, 10>;
+    SVec v = {"a", "b", "c"};
+    inclusive_scan(v);
+    assert(v == SVec({"a", "ab", "abc"}));
+    exclusive_scan(v, std::string(">"));
+    assert(v == SVec({">", ">a", ">aab"}));
+}
+
+void test_scan_3() {
+    // Large enough to take the multithreaded path
+    std::vector<long long> v(1 << 20);
+    for (std::size_t i = 0; i < v.size(); ++i)
+        v[i] = (i * 7919) % 1000 - 500;
+
+    std::vector<long long> expected(v.size());
+    std::inclusive_scan(v.begin(), v.end(), expected.begin());
+    std::vector<long long> inc = v;
+    inclusive_scan(inc);
+    assert(inc == expected);
+
+    std::exclusive_scan(v.begin(), v.end(), expected.begin(), 5LL);
+    std::vector<long long> exc = v;
+    exclusive_scan(exc, 5LL);
+    assert(exc == expected);
+
+    auto max_op = [](long long a, long long b) { return std::max(a, b); };
+    std::inclusive_scan(v.begin(), v.end(), expected.begin(), max_op);
+    std::vector<long long> mx = v;
+    inclusive_scan(mx, max_op);
+    assert(mx == expected);
+}
+
+void test_scan_4() {
+    std::vector<int> v(1 << 20, 1);
+    std::vector<bool> heads(v.size());
+    for (std::size_t i = 0; i < v.size(); i += 1 + (i * 31) % 100000)
+        heads[i] = true;
+
+    std::vector<int> expected = v;
+    for (std::size_t i = 1; i < v.size(); ++i)
+        if (!heads[i])
+            expected[i] += expected[i - 1];
+    segmented_inclusive_scan(v, heads);
+    assert(v == expected);
+
+    try { segmented_inclusive_scan(v, std::vector<bool>(3)); assert(0); }
+    catch(const std::invalid_argument& e) {
+        assert(e.what() == std::string("Segment flags must match vector size."));
+    }
+}
+
+constexpr void test_range_query_1() {
+    constexpr MyVec<int, 10> v = {5, -2, 7, 1, 9, 3};
+    constexpr auto sums = make_prefix_sum_index(v);
+    static_assert(sums.sum(0, 6) == 23);
+    static_assert(sums.sum(1, 3) == 5);
+    static_assert(sums.sum(4, 4) == 0);
+
+    constexpr auto mins = make_sparse_table<min_op>(v);
+    constexpr auto maxs = make_sparse_table<max_op>(v);
+    static_assert(mins.query(0, 6) == -2);
+    static_assert(mins.query(2, 6) == 1);
+    static_assert(maxs.query(0, 4) == 7);
+    static_assert(maxs.query(5, 6) == 3);
+
+    constexpr std::array<int, 4> a = {4, 3, 2, 1};
+    static_assert(make_prefix_sum_index(a).sum(1, 4) == 6);
+    static_assert(make_sparse_table<min_op>(a).query(0, 3) == 2);
+}
+
+void test_range_query_2() {
+    std::vector<int> v(1000);
+    for (std::size_t i = 0; i < v.size(); ++i)
+        v[i] = (i * 7919) % 1000 - 500;
+    PrefixSumIndex<int, 1000> sums(v.data(), v.size());
+    SparseTable<int, 1000, min_op> mins(v.data(), v.size());
+    for (std::size_t l = 0; l < v.size(); l += 37)
+        for (std::size_t r = l + 1; r <= v.size(); r += 53) {
+            assert(sums.sum(l, r) == std::accumulate(v.begin() + l, v.begin() + r, 0));
+            assert(mins.query(l, r) == *std::min_element(v.begin() + l, v.begin() + r));
+        }
+
+    try { mins.query(3, 3); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("Range out of bounds."));
+    }
+    try { sums.sum(0, 1001); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("Range out of bounds."));
+    }
+}
+
+constexpr void test_concept_5() {
+    static_assert(FixedCapacityVector<MyVec<int, 10>>);
+    static_assert(FixedCapacityVector<MyVec<std::string, 10>>);
+    static_assert(!FixedCapacityVector<std::vector<int>>);
+    static_assert(MyVec<int, 10>::static_capacity == 10);
+}
+
+constexpr void test_fixed_capacity_1() {
+    constexpr MyVec<int, 10> v = [] {
+        MyVec<int, 10> v = {5, 3, 9, 1, 3};
+        sort(v);
+        return v;
+    }();
+    static_assert(v == MyVec<int, 10>({1, 3, 3, 5, 9}));
+    static_assert(reduce(v, 0) == 21);
+    static_assert(lower_bound(v, 3) == v.begin() + 1);
+    static_assert(lower_bound(v, 4) == v.begin() + 3);
+    static_assert(lower_bound(v, 10) == v.end());
+
+    constexpr MyVec<int, 100> w = [] {
+        MyVec<int, 100> w = {5, 3, 9, 1, 3};
+        stable_sort(w, std::greater<>{});
+        exclusive_scan(w, 0);
+        return w;
+    }();
+    static_assert(w == MyVec<int, 100>({0, 9, 14, 17, 20}));
+}
+
+void test_fixed_capacity_2() {
+    // Every prefix length of the unrolled sorting network, for a capacity
+    // that is not a power of two.
+    unsigned seed = 1;
+    for (std::size_t n = 0; n <= 20; ++n) {
+        for (int round = 0; round < 50; ++round) {
+            MyVec<int, 20> v;
+            for (std::size_t i = 0; i < n; ++i) {
+                seed = seed * 1103515245 + 12345;
+                v.push_back((seed >> 16) % 10);
+            }
+            std::vector<int> expected(v.begin(), v.end());
+            std::sort(expected.begin(), expected.end());
+            sort(v);
+            assert(std::equal(v.begin(), v.end(), expected.begin(), expected.end()));
+
+            for (int x = -1; x <= 10; ++x)
+                assert(lower_bound(v, x) - v.begin() ==
+                       std::lower_bound(expected.begin(), expected.end(), x) - expected.begin());
+
+            MyVec<int, 20> scanned = v;
+            inclusive_scan(scanned);
+            std::inclusive_scan(expected.begin(), expected.end(), expected.begin());
+            assert(std::equal(scanned.begin(), scanned.end(), expected.begin(), expected.end()));
+        }
+    }
+}
+
+void test_fixed_capacity_3() {
+    using P = std::pair<int, int>;
+    using PVec = MyVec<P, 10>;
+    PVec v = {{2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}};
+    auto by_first = [](const P& a, const P& b) { return a.first < b.first; };
+    stable_sort(v, by_first);
+    assert(v == PVec({{0, 4}, {1, 1}, {1, 3}, {2, 0}, {2, 2}}));
+
+    MyVec<std::string, 10> s = {"c", "a", "b"};
+    sort(s);
+    assert(reduce(s, std::string()) == "abc");
+}
+
+// 0-1 principle: a network sorts every input iff it sorts every 0/1 input.
+template<std::size_t N>
+constexpr bool sorts_all_binary_inputs() {
+    for (unsigned bits = 0; bits < (1u << N); ++bits) {
+        MyVec<int, N> v;
+        for (std::size_t i = 0; i < N; ++i)
+            v.push_back((bits >> i) & 1);
+        sort(v);
+        if (!std::is_sorted(v.begin(), v.end()))
+            return false;
+    }
+    return true;
+}
+
+constexpr void test_sort_1() {
+    static_assert(sorts_all_binary_inputs<2>() && sorts_all_binary_inputs<3>());
+    static_assert(sorts_all_binary_inputs<4>() && sorts_all_binary_inputs<5>());
+    static_assert(sorts_all_binary_inputs<6>() && sorts_all_binary_inputs<7>());
+    static_assert(sorts_all_binary_inputs<8>() && sorts_all_binary_inputs<11>());
+
+    // Radix sort during constant evaluation
+    constexpr MyVec<int, 500> v = [] {
+        MyVec<int, 500> v;
+        for (int i = 0; i < 500; ++i)
+            v.push_back((i * 7919) % 1000 - 500);
+        sort(v);
+        return v;
+    }();
+    static_assert(std::is_sorted(v.begin(), v.end()));
+    static_assert(v.front() == -500 && v.back() == 499);
+}
+
+template<class T, std::size_t N, class Compare = std::less<>>
+void check_sort(std::size_t n, Compare comp = {}) {
+    static unsigned seed = 1;
+    MyVec<T, N> v;
+    for (std::size_t i = 0; i < n; ++i) {
+        seed = seed * 1103515245 + 12345;
+        v.push_back(static_cast<T>(seed ^ (seed >> 7)));
+    }
+    std::vector<T> expected(v.begin(), v.end());
+    std::sort(expected.begin(), expected.end(), comp);
+    sort(v, comp);
+    assert(std::equal(v.begin(), v.end(), expected.begin(), expected.end()));
+}
+
+void test_sort_2() {
+    for (std::size_t n = 0; n <= 8; ++n)
+        check_sort<int, 8>(n);
+    for (std::size_t n : {0, 1, 127, 128, 1000}) {
+        check_sort<int, 1000>(n);
+        check_sort<int, 1000>(n, std::greater<>{});
+        check_sort<unsigned char, 1000>(n);
+        check_sort<short, 1000>(n);
+        check_sort<unsigned long long, 1000>(n);
+        check_sort<double, 1000>(n);
+    }
+    check_sort<long long, 5000>(5000);
+}
+
+constexpr void test_expr_1() {
+    using DVec = MyVec<double, 10>;
+    constexpr DVec a = {1, 2, 3};
+    constexpr DVec b = {4, 5, 6};
+    constexpr DVec c = {7, 8, 9};
+    constexpr DVec d = {1, 1, 1};
+    constexpr DVec r = a + b * c - d;
+    static_assert(r == DVec({28, 41, 56}));
+    constexpr DVec s = 2.0 * a - 1.0;
+    static_assert(s == DVec({1, 3, 5}));
+    constexpr DVec t = -(a / b) + a / b;
+    static_assert(t == DVec({0, 0, 0}));
+    static_assert((a + b).size() == 3);
+}
+
+void test_expr_2() {
+    std::vector<int> a = {1, 2, 3};
+    MyVec<int, 10> b = {10, 20, 30};
+    std::vector<int> r = vec_expr(a) * b + vec_expr(a);
+    assert(r == std::vector<int>({11, 42, 93}));
+
+    // Evaluating into an existing vector resizes it
+    MyVec<int, 10> out(7);
+    (b - 10).evaluate_into(out);
+    assert((out == MyVec<int, 10>{0, 10, 20}));
+
+    MyVec<std::string, 10> x = {"a", "b"};
+    MyVec<std::string, 10> y = {"c", "d"};
+    MyVec<std::string, 10> xy = x + y;
+    assert(xy[0] == "ac" && xy[1] == "bd");
+
+    try { (void)(b + MyVec<int, 10>(2)); assert(0); }
+    catch(const std::invalid_argument& e) {
+        assert(e.what() == std::string("Operand sizes must match."));
+    }
+}
+
+constexpr void test_views_1() {
+    constexpr MyVec<int, 10> v = {1, 2, 3, 4, 5, 6, 7};
+    static_assert(std::same_as<decltype(v.first<3>()), std::span<const int, 3>>);
+    static_assert(v.first<3>()[2] == 3);
+    static_assert(v.last<2>()[0] == 6);
+    static_assert(v.subspan<2, 4>()[0] == 3 && v.subspan<2, 4>()[3] == 6);
+    static_assert(v.span().size() == 7);
+
+    static_assert(chunks<3>(v).size() == 2);
+    static_assert(chunks<3>(v)[1][0] == 4);
+    static_assert(chunks<3>(v).remainder().size() == 1 && chunks<3>(v).remainder()[0] == 7);
+    static_assert(std::ranges::forward_range<ChunkView<int, 3>>);
+
+    // Kernels on views modify the MyVec in place
+    constexpr MyVec<int, 10> w = [] {
+        MyVec<int, 10> w = {4, 3, 2, 1, 1, 1, 1, 1};
+        sort(w.first<4>());
+        for (std::span<int, 2> chunk : chunks<2>(w.subspan<4, 4>()))
+            inclusive_scan(chunk);
+        return w;
+    }();
+    static_assert(w == MyVec<int, 10>({1, 2, 3, 4, 1, 2, 1, 2}));
+    static_assert(reduce(w.first<4>(), 0) == 10);
+}
+
+void test_views_2() {
+    MyVec<int, 10> v = {1, 2, 3};
+    try { (void)v.first<4>(); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("View out of range."));
+    }
+    try { (void)v.subspan<2, 2>(); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("View out of range."));
+    }
+
+    std::span<int> s = v.span();
+    exclusive_scan(s, 0);
+    assert((v == MyVec<int, 10>{0, 1, 3}));
+
+    std::vector<int> u(10, 1);
+    int sum = 0;
+    for (auto chunk : chunks<4>(u))
+        sum += reduce(chunk, 0);
+    assert(sum == 8);
+    assert(chunks<4>(u).remainder().size() == 2);
+}
+
+constexpr void test_matrix_1() {
+    using M23 = MyMatrix<int, 2, 3>;
+    using M32 = MyMatrix<int, 3, 2>;
+    constexpr M23 a = {{1, 2, 3}, {4, 5, 6}};
+    constexpr M32 b = {{7, 8}, {9, 10}, {11, 12}};
+    static_assert(a * b == MyMatrix<int, 2, 2>({{58, 64}, {139, 154}}));
+    static_assert(a.transpose() == M32({{1, 4}, {2, 5}, {3, 6}}));
+    static_assert(a * MyMatrix<int, 3, 3>::identity() == a);
+    static_assert(a(1, 2) == 6);
+
+    // Same contents regardless of layout
+    constexpr auto a_col = a.relayout<col_major>();
+    constexpr auto a_tiled = a.relayout<tiled<2>>();
+    static_assert(a_col.data()[1] == 4);
+    static_assert(a_tiled.data()[2] == 4 && a_tiled(1, 2) == 6);
+    static_assert(a_col.relayout<row_major>() == a && a_tiled.relayout<row_major>() == a);
+    static_assert((a_col * b.relayout<col_major>()).relayout<row_major>() == a * b);
+
+    constexpr MyTensor<int, 2, 3, 4> t = [] {
+        MyTensor<int, 2, 3, 4> t;
+        for (int i = 0; i < 2; ++i)
+            for (int j = 0; j < 3; ++j)
+                for (int k = 0; k < 4; ++k)
+                    t(i, j, k) = 100 * i + 10 * j + k;
+        return t;
+    }();
+    static_assert(t(1, 2, 3) == 123);
+    static_assert(t.data()[12] == 100);
+    static_assert(MyTensor<int, 2, 3, 4>::size() == 24);
+}
+
+void test_matrix_2() {
+    // Runtime blocked kernels, with sizes that are not multiples of the block
+    constexpr std::size_t R = 70, K = 65, C = 130;
+    auto a = std::make_unique<MyMatrix<long long, R, K>>();
+    auto b = std::make_unique<MyMatrix<long long, K, C>>();
+    for (std::size_t i = 0; i < R; ++i)
+        for (std::size_t k = 0; k < K; ++k)
+            (*a)(i, k) = (i * 31 + k * 17) % 11;
+    for (std::size_t k = 0; k < K; ++k)
+        for (std::size_t j = 0; j < C; ++j)
+            (*b)(k, j) = (k * 13 + j * 7) % 5;
+
+    auto c = std::make_unique<MyMatrix<long long, R, C>>(*a * *b);
+    for (std::size_t i = 0; i < R; ++i)
+        for (std::size_t j = 0; j < C; ++j) {
+            long long expected = 0;
+            for (std::size_t k = 0; k < K; ++k)
+                expected += (*a)(i, k) * (*b)(k, j);
+            assert((*c)(i, j) == expected);
+        }
+
+    auto bt = std::make_unique<MyMatrix<long long, C, K>>(b->transpose());
+    for (std::size_t k = 0; k < K; ++k)
+        for (std::size_t j = 0; j < C; ++j)
+            assert((*bt)(j, k) == (*b)(k, j));
+
+    // Column-major goes through the same kernels with the operands swapped
+    auto a_col = std::make_unique<MyMatrix<long long, R, K, col_major>>(a->relayout<col_major>());
+    auto b_col = std::make_unique<MyMatrix<long long, K, C, col_major>>(b->relayout<col_major>());
+    auto c_col = std::make_unique<MyMatrix<long long, R, C, col_major>>(*a_col * *b_col);
+    assert(c_col->relayout<row_major>() == *c);
+    auto bt_col = std::make_unique<MyMatrix<long long, C, K, col_major>>(b_col->transpose());
+    assert(bt_col->relayout<row_major>() == *bt);
+    MyMatrix<int, 2, 3, col_major> small_a = {{1, 2, 3}, {4, 5, 6}};
+    MyMatrix<int, 3, 2, col_major> small_b = {{7, 8}, {9, 10}, {11, 12}};
+    assert((small_a * small_b == MyMatrix<int, 2, 2, col_major>({{58, 64}, {139, 154}})));
+
+    try { (void)a->at(R, 0); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("Index out of range."));
+    }
+    MyTensor<int, 2, 2> t;
+    try { (void)t.at(0, 2); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("Index out of range."));
+    }
+}
+
+constexpr void test_bitvec_1() {
+    // Sieve of Eratosthenes: bit i set means i is composite
+    constexpr auto composite = [] {
+        MyBitVec<1000> c(1000);
+        c.set(0).set(1);
+        for (std::size_t p = 2; p * p < c.size(); ++p)
+            if (!c[p])
+                c.set_stride(p * p, p);
+        return c;
+    }();
+    static_assert(composite.size() == 1000 && composite.count() == 1000 - 168);
+    static_assert(!composite[997] && composite[999]);
+
+    constexpr auto primes = [&] {
+        MyBitVec<1000> p = composite;
+        return p.flip();
+    }();
+    static_assert(primes.count() == 168);
+    static_assert(primes.find_first() == 2 && primes.find_next(2) == 3 && primes.find_next(997) == MyBitVec<1000>::npos);
+    static_assert(primes.rank(100) == 25 && primes.rank(1000) == 168);
+    static_assert(primes.select(0) == 2 && primes.select(24) == 97 && primes.select(167) == 997);
+    static_assert(primes.select(168) == MyBitVec<1000>::npos);
+
+    constexpr MyBitVec<130> ones = [] {
+        MyBitVec<130> b;
+        b.resize(3);
+        b.resize(130, true);
+        return b;
+    }();
+    static_assert(ones.count() == 127 && ones.find_first() == 3 && ones.back());
+    static_assert(MyBitVec<130>(ones).flip().count() == 3);
+}
+
+void test_bitvec_2() {
+    MyBitVec<200> a, b;
+    for (int i = 0; i < 150; ++i) {
+        a.push_back(i % 2 == 0);
+        b.push_back(i % 3 == 0);
+    }
+    assert(a.size() == 150 && a.count() == 75 && b.count() == 50);
+
+    MyBitVec<200> both = a;
+    both &= b;
+    assert(both.count() == 25 && both.find_next(0) == 6);
+    MyBitVec<200> either = a;
+    either |= b;
+    assert(either.count() == 100);
+    MyBitVec<200> one = a;
+    one ^= b;
+    assert(one.count() == 75);
+
+    // Shrinking clears the dropped bits, so growing again yields zeros
+    a.resize(65);
+    assert(a.count() == 33 && a.words_in_use() == 2);
+    a.resize(100);
+    assert(a.count() == 33 && a.find_next(64) == MyBitVec<200>::npos);
+    a.pop_back();
+    a[10] = false;
+    a[11] = a[12];
+    assert(a.size() == 99 && !a[10] && a[11] && a.rank(99) == 33);
+
+    // Word-at-a-time strides agree with setting bit by bit
+    for (std::size_t stride = 1; stride <= 70; ++stride)
+        for (std::size_t first : {0, 5, 63, 64, 130}) {
+            MyBitVec<200> fast(190, stride % 2 == 0), slow = fast;
+            fast.set_stride(first, stride, stride % 2 != 0);
+            for (std::size_t pos = first; pos < slow.size(); pos += stride)
+                slow.set(pos, stride % 2 != 0);
+            assert(fast == slow && fast.count() == slow.count());
+        }
+
+    a.clear();
+    assert(a.empty() && a.none());
+    a.resize(200, true);
+    assert(a.all() && a.count() == 200);
+
+    try { a.push_back(true); assert(0); }
+    catch(const std::length_error& e) {
+        assert(e.what() == std::string("Cannot exceed preset capacity."));
+    }
+    try { (void)a.test(200); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("Index out of range."));
+    }
+    try { a &= b; assert(0); }
+    catch(const std::invalid_argument& e) {
+        assert(e.what() == std::string("Operand sizes must match."));
+    }
+    try { a.set_stride(0, 0); assert(0); }
+    catch(const std::invalid_argument& e) {
+        assert(e.what() == std::string("Stride must be positive."));
+    }
+}
+
+constexpr void test_stats_1() {
+    // Front inserts shift everything already stored: 0 + 1 + ... + 7
+    constexpr auto front_inserts = [] {
+        MyVec<int, 16> v;
+        for (int i = 0; i < 8; ++i)
+            v.insert(v.begin(), i);
+        v.erase(v.begin() + 6);
+        return v;
+    };
+    static_assert(front_inserts().size() == 7);
+#ifdef MYVEC_STATS
+    static_assert(vec_stats(front_inserts()).enabled);
+    static_assert(vec_stats(front_inserts()).high_water == 8 && vec_stats(front_inserts()).capacity == 16);
+    static_assert(vec_stats(front_inserts()).shifts == 8 && vec_stats(front_inserts()).shifted == 29);
+    static_assert(vec_stats(front_inserts()).longest_shift == 7 && vec_stats(front_inserts()).copies == 37);
+#else
+    static_assert(!vec_stats(front_inserts()).enabled);
+#endif
+}
+
+void test_stats_2() {
+    MyVec<int, 4> v = {1, 2};
+    v.push_back(3);
+    v.resize(1);
+    try { v.insert(v.begin(), 4, 0); assert(0); }
+    catch(const std::length_error& e) {}
+    try { (void)v.at(1); assert(0); }
+    catch(const std::out_of_range& e) {}
+
+    VecStats s = v.stats();
+    std::ostringstream out;
+    out << s;
+#ifdef MYVEC_STATS
+    assert(s.high_water == 3 && s.copies == 3 && s.shifts == 0 && s.failed_checks == 2);
+    assert(out.str().find("high water:    3 / 4") != std::string::npos);
+
+    // Swapping exchanges the histories along with the elements
+    MyVec<int, 4> w;
+    w.insert(w.begin(), 5);
+    w.insert(w.begin(), 6);
+    v.swap(w);
+    assert(v.stats().shifts == 1 && v.stats().copies == 3 && v.stats().failed_checks == 0);
+    assert(w.stats().shifts == 0 && w.stats().copies == 3 && w.stats().failed_checks == 2);
+    std::swap(v, w);
+    assert(v.stats().failed_checks == 2 && w.stats().shifts == 1);
+#else
+    assert(!s.enabled && s.copies == 0);
+    assert(out.str().find("disabled") != std::string::npos);
+#endif
+}
+
+void test_concurrent_1() {
+    // More pushes than slots: exactly N succeed, each value lands exactly once
+    constexpr std::size_t N = 6000;
+    constexpr int producers = 8, per_producer = 1000;
+    auto v = std::make_unique<ConcurrentMyVec<int, N>>();
+    std::atomic<int> accepted = 0;
+    std::atomic<bool> done = false;
+    {
+        std::vector<std::jthread> threads;
+        // A reader polling while producers run only ever sees complete elements
+        threads.emplace_back([&] {
+            while (!done.load())
+                for (int x : v->snapshot())
+                    assert(x > 0);
+        });
+        std::vector<std::jthread> workers;
+        for (int t = 0; t < producers; ++t)
+            workers.emplace_back([&, t] {
+                for (int i = 0; i < per_producer; ++i)
+                    if (v->try_push_back(t * per_producer + i + 1))
+                        ++accepted;
+            });
+        workers.clear();
+        done = true;
+    }
+    assert(accepted == int(N) && v->size() == N && v->full());
+    assert(!v->try_push_back(1));
+
+    std::vector<int> seen(v->begin(), v->end());
+    std::sort(seen.begin(), seen.end());
+    assert(std::adjacent_find(seen.begin(), seen.end()) == seen.end());
+    assert(seen.front() > 0 && seen.back() <= producers * per_producer);
+
+    try { v->push_back(1); assert(0); }
+    catch(const std::length_error& e) {
+        assert(e.what() == std::string("Cannot exceed preset capacity."));
+    }
+    v->clear();
+    assert(v->empty() && v->try_push_back(7) && v->at(0) == 7);
+    try { (void)v->at(1); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("Index out of range."));
+    }
+
+    // Elements are constructed in place, so they need neither a default
+    // constructor nor to be movable; clear() and the destructor destroy them
+    struct Tracked {
+        explicit Tracked(int& live) : live(&live) { ++live; }
+        Tracked(const Tracked&) = delete;
+        ~Tracked() { --*live; }
+        int* live;
+    };
+    int live = 0;
+    {
+        ConcurrentMyVec<Tracked, 4> tracked;
+        assert(tracked.try_emplace_back(live) && tracked.try_emplace_back(live) && live == 2);
+        tracked.clear();
+        assert(live == 0 && tracked.empty() && tracked.try_emplace_back(live) && live == 1);
+    }
+    assert(live == 0);
+}
+
+void test_arena_1() {
+    // Growing one element at a time fits the computed size exactly
+    auto mono = std::make_unique<VecArena<long long, 1000>>();
+    CountingResource counted(mono.get());
+    {
+        std::pmr::vector<long long> v(&counted);
+        for (int i = 0; i < 1000; ++i)
+            v.push_back(i);
+        assert(v[999] == 999 && counted.allocations() == 11);
+        assert(mono->used() == (2 * 1024 - 1) * sizeof(long long));
+    }
+    assert(counted.deallocations() == 11);
+    try {
+        std::pmr::vector<long long> w(2000, 0, mono.get());
+        assert(0);
+    }
+    catch(const std::bad_alloc&) {}
+    mono->release();
+    assert(mono->used() == 0);
+
+    // Pooled blocks are reused, so repeated builds stop consuming the buffer
+    auto pool = std::make_unique<VecArena<std::string, 100, ArenaMode::pooled>>();
+    std::size_t after_first = 0;
+    for (int round = 0; round < 5; ++round) {
+        std::pmr::vector<std::string> v(pool.get());
+        for (int i = 0; i < 100; ++i)
+            v.emplace_back(std::to_string(i));
+        assert(v[42] == "42");
+        if (round == 0)
+            after_first = pool->used();
+    }
+    assert(pool->used() == after_first && pool->used() <= pool->capacity());
+
+    // Over-aligned requests are honoured in both modes
+    StaticArenaResource<1024, ArenaMode::pooled> small;
+    void* p = small.allocate(8, 1);
+    void* q = small.allocate(64, 64);
+    assert(reinterpret_cast<std::uintptr_t>(q) % 64 == 0);
+    small.deallocate(p, 8, 1);
+    assert(small.allocate(16, 8) == p);
+}
+
+constexpr void test_priority_queue_1() {
+    // Heap sort through the queue, for a few arities
+    constexpr auto drain = []<std::size_t D>() {
+        MyVec<int, 64> in;
+        for (int i = 0; i < 50; ++i)
+            in.push_back((i * 37) % 50);
+        MyPriorityQueue<int, 64, std::less<int>, D> q;
+        for (int x : in)
+            q.push(x);
+        MyVec<int, 64> out;
+        while (!q.empty()) {
+            out.push_back(q.top());
+            q.pop();
+        }
+        return out;
+    };
+    static_assert(drain.template operator()<2>().front() == 49 && drain.template operator()<2>().back() == 0);
+    static_assert(drain.template operator()<4>() == drain.template operator()<2>());
+    static_assert(drain.template operator()<7>() == drain.template operator()<2>());
+
+    constexpr auto heapified = [] {
+        int data[] = {5, 1, 9, 3, 7, 2, 8};
+        MyPriorityQueue<int, 8, std::greater<int>> q(std::begin(data), std::end(data));
+        int a = q.top(); q.pop();
+        int b = q.top();
+        return a * 10 + b;
+    }();
+    static_assert(heapified == 12);
+
+    // Dijkstra with decrease-key over a small weighted graph
+    constexpr auto dist = [] {
+        constexpr int V = 6;
+        constexpr int w[V][V] = {
+            {0, 7, 9, 0, 0, 14}, {7, 0, 10, 15, 0, 0}, {9, 10, 0, 11, 0, 2},
+            {0, 15, 11, 0, 6, 0}, {0, 0, 0, 6, 0, 9}, {14, 0, 2, 0, 9, 0},
+        };
+        std::array<int, V> d;
+        for (int& x : d)
+            x = 1 << 20;
+        MyIndexedPriorityQueue<int, V, std::greater<int>> q;
+        d[0] = 0;
+        q.push(0, 0);
+        while (!q.empty()) {
+            auto [u, du] = q.top();
+            q.pop();
+            for (int v = 0; v < V; ++v)
+                if (w[u][v] && du + w[u][v] < d[v]) {
+                    d[v] = du + w[u][v];
+                    q.push_or_update(v, d[v]);
+                }
+        }
+        return d;
+    }();
+    static_assert(dist[4] == 20 && dist[5] == 11 && dist[3] == 20);
+}
+
+void test_priority_queue_2() {
+    // Random pushes and pops agree with std::priority_queue
+    std::priority_queue<unsigned> ref;
+    MyPriorityQueue<unsigned, 1000> q;
+    unsigned seed = 12345;
+    for (int step = 0; step < 20000; ++step) {
+        seed = seed * 1103515245 + 12345;
+        if ((seed >> 16) % 3 != 0 && q.size() < q.capacity()) {
+            q.push(seed >> 8);
+            ref.push(seed >> 8);
+        } else if (!ref.empty()) {
+            assert(q.top() == ref.top());
+            q.pop();
+            ref.pop();
+        }
+        assert(q.size() == ref.size());
+    }
+
+    MyIndexedPriorityQueue<int, 10> iq;
+    for (int k = 0; k < 10; ++k)
+        iq.push(k, k * 10);
+    iq.update(3, 1000);
+    iq.update(9, -5);
+    iq.erase(8);
+    assert(iq.top_key() == 3 && iq.priority(9) == -5 && !iq.contains(8));
+    int last = 1 << 30;
+    while (!iq.empty()) {
+        assert(iq.top().second <= last);
+        last = iq.top().second;
+        iq.pop();
+    }
+    assert(last == -5);
+
+    try { iq.push(10, 0); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("Index out of range."));
+    }
+    iq.push(1, 0);
+    try { iq.push(1, 0); assert(0); }
+    catch(const std::invalid_argument& e) {
+        assert(e.what() == std::string("Key already present."));
+    }
+    try { iq.update(2, 0); assert(0); }
+    catch(const std::invalid_argument& e) {
+        assert(e.what() == std::string("Key not present."));
+    }
+    MyPriorityQueue<int, 1> full;
+    full.push(1);
+    try { full.push(2); assert(0); }
+    catch(const std::length_error& e) {
+        assert(e.what() == std::string("Cannot exceed preset capacity."));
+    }
+}
+
+constexpr void test_gap_vec_1() {
+    // Typing, cursor moves, backspace and delete, as in an editor buffer
+    constexpr auto edited = [] {
+        MyGapVec<char, 32> buf = {'h', 'e', 'l', 'o'};
+        buf.move_cursor(3);
+        buf.insert_at_cursor('l');
+        buf.move_cursor(buf.size());
+        for (char c : {' ', 'x', 'y'})
+            buf.insert_at_cursor(c);
+        buf.erase_before_cursor();
+        buf.move_cursor(0);
+        buf.erase_after_cursor();
+        buf.insert_at_cursor('H');
+        return buf.to_vec();
+    }();
+    static_assert(edited == MyVec<char, 32>{'H', 'e', 'l', 'l', 'o', ' ', 'x'});
+
+    constexpr auto by_position = [] {
+        MyGapVec<int, 16> v;
+        for (int i = 0; i < 6; ++i)
+            v.push_back(i);
+        v.insert(v.begin() + 2, 10);
+        v.erase(v.begin() + 4, v.begin() + 6);
+        v.push_back(20);
+        v.pop_back();
+        v.push_back(30);
+        int sum = 0;
+        for (int x : v.span())
+            sum = sum * 10 + x;
+        return std::pair{sum, v.cursor() == v.size()};
+    }();
+    static_assert(by_position.first == 1 * 10000 + 10 * 1000 + 2 * 100 + 5 * 10 + 30);
+    static_assert(by_position.second);
+}
+
+void test_gap_vec_2() {
+    // Random edits around a drifting cursor agree with std::vector
+    std::vector<int> ref;
+    auto v = std::make_unique<MyGapVec<int, 500>>();
+    unsigned seed = 777;
+    std::size_t at = 0;
+    for (int step = 0; step < 20000; ++step) {
+        seed = seed * 1103515245 + 12345;
+        unsigned r = seed >> 16;
+        at = std::min(ref.size(), at + r % 5 - std::min<std::size_t>(at, 2));
+        if (r % 7 < 4 && !v->full()) {
+            v->insert(v->begin() + at, step);
+            ref.insert(ref.begin() + at, step);
+        } else if (r % 7 < 6 && at < ref.size()) {
+            v->erase(v->begin() + at);
+            ref.erase(ref.begin() + at);
+        } else if (r % 7 == 6 && !v->full()) {
+            v->push_back(-step);
+            ref.push_back(-step);
+        } else if (!ref.empty()) {
+            v->pop_back();
+            ref.pop_back();
+            at = std::min(at, ref.size());
+        }
+        assert(v->size() == ref.size());
+    }
+    assert(std::equal(v->begin(), v->end(), ref.begin(), ref.end()));
+    auto [before, after] = v->segments();
+    assert(before.size() + after.size() == ref.size());
+    assert(std::equal(after.begin(), after.end(), ref.end() - after.size()));
+    auto all = v->span();
+    assert(std::equal(all.begin(), all.end(), ref.begin(), ref.end()));
+
+    MyGapVec<int, 8> small(v->begin(), v->begin() + 8);
+    std::sort(small.begin(), small.end());
+    assert(std::is_sorted(small.cbegin(), small.cend()) && small.full());
+    try { small.insert(small.begin(), 1); assert(0); }
+    catch(const std::length_error& e) {
+        assert(e.what() == std::string("Cannot exceed preset capacity."));
+    }
+    try { small.move_cursor(9); assert(0); }
+    catch(const std::out_of_range& e) {
+        assert(e.what() == std::string("Index out of range."));
+    }
+}
+
+constexpr void test_comparator_5() {
+    // The constexpr fallbacks agree with the runtime fast paths below
+    using B = MyVec<unsigned char, 8>;
+    static_assert(B{1, 2, 200} > B{1, 2, 3} && B{1, 2} < B{1, 2, 0} && B{} == B{});
+    static_assert(MyVec<int, 8>{-1, 5} < MyVec<int, 8>{0} && MyVec<int, 8>{3, 4} == MyVec<int, 8>{3, 4});
+}
+
+// Compares and hashes only `key`, so equal elements can have different bytes
+struct KeyedTag {
+    int key;
+    int tag;
+
+    friend constexpr bool operator==(const KeyedTag& a, const KeyedTag& b) { return a.key == b.key; }
+    friend constexpr auto operator<=>(const KeyedTag& a, const KeyedTag& b) { return a.key <=> b.key; }
+};
+
+template<>
+struct std::hash<KeyedTag> {
+    std::size_t operator()(const KeyedTag& k) const noexcept { return std::hash<int>()(k.key); }
+};
+
+void test_comparator_6() {
+    // Differences before, inside and after the first memcmp block
+    for (std::size_t at : {0, 5, 63, 64, 65, 700, 999}) {
+        auto a = std::make_unique<MyVec<int, 1000>>(1000, 7);
+        auto b = std::make_unique<MyVec<int, 1000>>(*a);
+        assert(*a == *b && (*a <=> *b) == 0);
+        (*b)[at] = -8;
+        assert(*a != *b && *a > *b && *b < *a);
+        b->resize(at);
+        assert(*a > *b);
+    }
+
+    MyVec<unsigned char, 8> x = {1, 255}, y = {1, 2, 3};
+    assert(x > y && y < x && (x <=> x) == 0);
+
+    // -0.0 == 0.0 even though their bytes differ
+    MyVec<double, 4> z1 = {0.0, 1.5}, z2 = {-0.0, 1.5};
+    assert(z1 == z2 && (z1 <=> z2) == 0);
+
+    // Stale elements past size() take no part in ==
+    MyVec<int, 4> p = {1, 2, 3}, q = {1, 2, 4};
+    p.pop_back();
+    q.pop_back();
+    assert(p == q);
+
+    // A user-defined == is honoured even when the bytes differ
+    MyVec<KeyedTag, 4> k1 = {{1, 10}, {2, 20}}, k2 = {{1, 11}, {2, 21}};
+    assert(k1 == k2 && (k1 <=> k2) == 0);
+    constexpr MyVec<KeyedTag, 4> c1 = {{1, 10}}, c2 = {{1, 11}};
+    static_assert(c1 == c2);
+}
+
+void test_hash_1() {
+    // Stale elements past size() take no part in the hash either
+    MyVec<int, 4> p = {1, 2, 3}, q = {1, 2, 4};
+    p.pop_back();
+    q.pop_back();
+    std::hash<MyVec<int, 4>> int_hash;
+    assert(int_hash(p) == int_hash(q));
+
+    MyVec<double, 4> z1 = {0.0, 1.5}, z2 = {-0.0, 1.5};
+    std::hash<MyVec<double, 4>> double_hash;
+    assert(double_hash(z1) == double_hash(z2));
+
+    // Elements that compare equal hash equally too
+    MyVec<KeyedTag, 4> k1 = {{1, 10}, {2, 20}}, k2 = {{1, 11}, {2, 21}};
+    std::hash<MyVec<KeyedTag, 4>> keyed_hash;
+    assert(keyed_hash(k1) == keyed_hash(k2));
+    std::unordered_set<MyVec<KeyedTag, 4>> keyed = {k1, k2};
+    assert(keyed.size() == 1);
+
+    using Key = MyVec<std::string, 3>;
+    std::unordered_set<Key> names;
+    names.insert(Key{"a", "b"});
+    names.insert(Key{"a", "b"});
+    names.insert(Key{"b", "a"});
+    names.insert(Key{"a", "b", ""});
+    assert(names.size() == 3);
+
+    std::unordered_set<MyVec<int, 16>> seen;
+    for (int i = 0; i < 1000; ++i) {
+        MyVec<int, 16> v;
+        for (int j = 0; j < i % 16; ++j)
+            v.push_back((i + j) % 7);
+        seen.insert(v);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        MyVec<int, 16> v;
+        for (int j = 0; j < i % 16; ++j)
+            v.push_back((i + j) % 7);
+        assert(seen.count(v) == 1);
+    }
+}
+
+void test_snapshot_1() {
+    std::string path = std::filesystem::temp_directory_path() / "test_snapshot.snap";
+    MyVec<long long, 1000> v;
+    for (int i = 0; i < 700; ++i)
+        v.push_back(1LL * i * i - 5000);
+    write_snapshot(path, v);
+    {
+        MyVecView<long long> view(path);
+        assert(view.size() == 700 && view.capacity() == 1000);
+        assert(view == v && view.verify());
+        assert(reinterpret_cast<std::uintptr_t>(view.data()) % snapshot_alignment == 0);
+        assert(view.back() == 699LL * 699 - 5000 && *view.rbegin() == view.back());
+        assert(std::accumulate(view.begin(), view.end(), 0LL) == std::accumulate(v.begin(), v.end(), 0LL));
+        assert((view.to_vec<1000>() == v));
+        try {
+            view.at(700);
+            assert(0);
+        }
+        catch(const std::out_of_range&) {}
+
+        // Moving keeps the mapping alive
+        MyVecView<long long> moved = std::move(view);
+        assert(moved[3] == 9 - 5000);
+    }
+
+    // Other element types, versions and truncated files are rejected on open
+    try {
+        MyVecView<double> wrong(path);
+        assert(0);
+    }
+    catch(const SnapshotError&) {}
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(offsetof(SnapshotHeader, version));
+        std::uint32_t version = 7;
+        f.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    try {
+        MyVecView<long long> old(path);
+        assert(0);
+    }
+    catch(const SnapshotError&) {}
+    write_snapshot(path, v);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    try {
+        MyVecView<long long> truncated(path);
+        assert(0);
+    }
+    catch(const SnapshotError&) {}
+
+    // Corrupted payloads open, but fail verify()
+    write_snapshot(path, v);
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(snapshot_alignment + 100);
+        f.put('\x7f');
+    }
+    assert(!MyVecView<long long>(path).verify());
+
+    // Empty snapshots and structs with their own tag
+    struct Point { int x, y; };
+    MyVec<Point, 4> points;
+    write_snapshot(path, points);
+    assert(MyVecView<Point>(path).empty() && MyVecView<Point>(path).verify());
+    points.push_back({1, 2});
+    points.push_back({3, 4});
+    write_snapshot(path, points);
+    MyVecView<Point> pv(path);
+    assert(pv.size() == 2 && pv[1].x == 3 && pv[1].y == 4);
+    std::filesystem::remove(path);
+
+    // Failed writes throw and leave no temporary file behind
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "test_snapshot_dir";
+    std::filesystem::create_directories(dir / "occupied");
+    try {
+        write_snapshot((dir / "missing" / "v.snap").string(), v);
+        assert(0);
+    }
+    catch(const std::system_error&) {}
+    try {
+        // Renaming a file over a directory fails after the write
+        write_snapshot((dir / "occupied").string(), v);
+        assert(0);
+    }
+    catch(const std::system_error& e) {
+        assert(std::string(e.what()).find("cannot replace it with the snapshot") != std::string::npos);
+    }
+    assert(!std::filesystem::exists(dir / "occupied.tmp") && std::filesystem::is_directory(dir / "occupied"));
+    std::filesystem::remove_all(dir);
+}
+
+void test_emit_1() {
+    // The hash agrees between constant evaluation and runtime
+    constexpr MyVec<int, 8> primes = {2, 3, 5, 7, 11};
+    constexpr std::uint64_t h = vec_content_hash(primes);
+    MyVec<int, 8> copy = primes;
+    assert(vec_content_hash(copy) == h);
+    copy[4] = 13;
+    assert(vec_content_hash(copy) != h);
+
+    std::ostringstream ints;
+    emit_constexpr_table(ints, "primes", primes);
+    assert(ints.str().starts_with("inline constexpr MyVec<int, 8> primes = {\n    2, 3, 5, 7, 11,\n};\n"));
+    assert(ints.str().find("static_assert(vec_content_hash(primes) == 0x") != std::string::npos);
+
+    // Floating point values round-trip, including the ones without a plain literal
+    MyVec<double, 8> reals = {1.0, -0.0, 0.1, 1e300, 5e-324, -std::numeric_limits<double>::infinity()};
+    std::ostringstream out;
+    emit_constexpr_table(out, "reals", reals);
+    std::string text = out.str();
+    for (std::string_view literal : {"1.0,", "-0.0,", "0.1,", "1e+300,", "5e-324,", "-std::numeric_limits<double>::infinity(),"})
+        assert(text.find(literal) != std::string::npos);
+    std::vector<float> floats = {0.5f, 3.0f};
+    out.str("");
+    emit_constexpr_table(out, "floats", floats);
+    assert(out.str().starts_with("inline constexpr std::array<float, 2> floats = {{\n    0.5f, 3.0f,\n}};\n"));
+
+    // Integers that need a suffix or an expression
+    std::vector<long long> extremes = {std::numeric_limits<long long>::min(), -1, std::numeric_limits<long long>::max()};
+    out.str("");
+    emit_constexpr_table(out, "extremes", extremes);
+    assert(out.str().find("-9223372036854775807LL - 1, -1LL, 9223372036854775807LL,") != std::string::npos);
+    std::vector<unsigned long long> big = {std::numeric_limits<unsigned long long>::max()};
+    out.str("");
+    emit_constexpr_table(out, "big", big);
+    assert(out.str().find("18446744073709551615ULL,") != std::string::npos);
+
+    // Long tables wrap at 100 columns
+    MyVec<int, 500> many(500, 123456);
+    out.str("");
+    emit_constexpr_table(out, "many", many);
+    std::istringstream lines(out.str());
+    std::size_t line_count = 0;
+    for (std::string line; std::getline(lines, line); ++line_count)
+        assert(line.size() <= 100);
+    assert(line_count > 40);
+
+    // Character types are written as prefixed hex escapes
+    std::vector<char8_t> utf8 = {u8'A', char8_t(0xff)};
+    std::vector<char16_t> utf16 = {u'\xd800'};
+    std::vector<char32_t> utf32 = {U'\x1f600'};
+    std::vector<wchar_t> wide = {L'z'};
+    out.str("");
+    emit_constexpr_table(out, "utf8", utf8);
+    emit_constexpr_table(out, "utf16", utf16);
+    emit_constexpr_table(out, "utf32", utf32);
+    emit_constexpr_table(out, "wide", wide);
+    for (std::string_view literal : {"std::array<char8_t, 2> utf8 = {{\n    u8'\\x41', u8'\\xff',",
+                                     "std::array<char16_t, 1> utf16 = {{\n    u'\\xd800',",
+                                     "std::array<char32_t, 1> utf32 = {{\n    U'\\x1f600',",
+                                     "std::array<wchar_t, 1> wide = {{\n    L'\\x7a',"})
+        assert(out.str().find(literal) != std::string::npos);
+
+    // Types without a spelling, or whose padding would change the hash, are rejected
+    auto emittable = [](auto v) { return requires(std::ostream& os) { emit_constexpr_table(os, "t", v); }; };
+    static_assert(emittable(std::vector<int>{}));
+    static_assert(!emittable(std::vector<long double>{}));
+    static_assert(!emittable(std::vector<int*>{}));
+
+    try {
+        emit_constexpr_table(out, "nan", std::vector<double>{std::nan("")});
+        assert(0);
+    }
+    catch(const std::domain_error&) {}
+}
+
 int main() {
     test_emplace_back_1(); test_emplace_back_2();
     test_push_back_1();
@@ -347,7 +1480,23 @@ int main() {
     test_erase_1(); test_erase_2(); test_erase_3(); test_erase_4(); test_erase_5(); test_erase_6(); test_erase_7();
     test_resize_1(); test_resize_2();
     test_swap_1();
-    test_comparator_1(); test_comparator_2(); test_comparator_3(); test_comparator_4();
+    test_comparator_1(); test_comparator_2(); test_comparator_3(); test_comparator_4(); test_comparator_6();
+    test_hash_1();
+    test_snapshot_1();
+    test_emit_1();
     test_assign_1(); test_assign_2(); test_assign_3();
+    test_scan_2(); test_scan_3(); test_scan_4();
+    test_range_query_2();
+    test_fixed_capacity_2(); test_fixed_capacity_3();
+    test_sort_2();
+    test_expr_2();
+    test_views_2();
+    test_matrix_2();
+    test_bitvec_2();
+    test_stats_2();
+    test_concurrent_1();
+    test_arena_1();
+    test_priority_queue_2();
+    test_gap_vec_2();
     std::cout << "All tests passed" << std::endl;
 }
\ No newline at end of file
@@ -0,0 +1,616 @@
+#ifndef VEC_ALGORITHMS_H
+#define VEC_ALGORITHMS_H
+
+#include "my_vector.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "vec_concepts.h"
+
+// Generic algorithms over the Vector concept.
+//
+// Every algorithm here is constexpr, so the same call works on a MyVec during
+// constant evaluation and on a std::vector at runtime. The runtime path may
+// take a faster route (e.g. multithreading) which is never used at compile time.
+
+namespace detail {
+
+// Below this many elements per worker, spawning threads costs more than it saves.
+inline constexpr std::size_t scan_grain = std::size_t(1) << 15;
+
+inline std::size_t scan_workers(std::size_t n) {
+    std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+    return std::min(hw, n / scan_grain);
+}
+
+// Runs body(w, lo, hi) for each of `workers` contiguous blocks of [0, n),
+// one thread per block. Block 0 runs on the calling thread.
+template<class Body>
+void for_each_block(std::size_t n, std::size_t workers, Body body) {
+    std::size_t block = (n + workers - 1) / workers;
+    std::vector<std::jthread> threads;
+    threads.reserve(workers - 1);
+    for (std::size_t w = 1; w < workers; ++w)
+        threads.emplace_back(body, w, w * block, std::min(n, (w + 1) * block));
+    body(0, 0, std::min(n, block));
+}
+
+// Two-pass blocked scan used by the runtime path.
+//
+// Pass 1 reduces every block but the last in parallel. The block sums are then
+// scanned sequentially into per-block carries, and pass 2 scans every block in
+// parallel seeded with its carry. This does about 2n applications of the
+// operator, against n for the sequential loop, so it only pays off with
+// enough workers.
+//
+// @param reduce      S reduce(lo, hi): combined value of [lo, hi)
+// @param combine     S combine(S, S): must be associative
+// @param scan_block  void scan_block(lo, hi, std::optional<S> carry)
+template<class S, class Reduce, class Combine, class ScanBlock>
+void blocked_scan(std::size_t n, std::size_t workers, std::optional<S> init,
+                  Reduce reduce, Combine combine, ScanBlock scan_block) {
+    std::size_t block = (n + workers - 1) / workers;
+    std::vector<std::optional<S>> carries(workers);
+
+    for_each_block((workers - 1) * block, workers - 1,
+        [&](std::size_t w, std::size_t lo, std::size_t hi) {
+            carries[w + 1] = reduce(lo, hi);
+        });
+
+    carries[0] = std::move(init);
+    for (std::size_t w = 1; w < workers; ++w)
+        if (carries[w - 1])
+            carries[w] = combine(*carries[w - 1], *carries[w]);
+
+    for_each_block(n, workers,
+        [&](std::size_t w, std::size_t lo, std::size_t hi) {
+            scan_block(lo, hi, carries[w]);
+        });
+}
+
+// Scan kernels over [p, p + n), shared by the Vector and FixedCapacityVector
+// overloads below.
+
+template<class T, class BinaryOp>
+constexpr void inclusive_scan_n(T* p, std::size_t n, BinaryOp& op) {
+    if (!std::is_constant_evaluated()) {
+        if (std::size_t workers = scan_workers(n); workers > 1) {
+            blocked_scan<T>(n, workers, std::nullopt,
+                [&](std::size_t lo, std::size_t hi) {
+                    T acc = p[lo];
+                    for (std::size_t i = lo + 1; i < hi; ++i)
+                        acc = op(std::move(acc), p[i]);
+                    return acc;
+                },
+                op,
+                [&](std::size_t lo, std::size_t hi, const std::optional<T>& carry) {
+                    if (carry)
+                        p[lo] = op(*carry, p[lo]);
+                    for (std::size_t i = lo + 1; i < hi; ++i)
+                        p[i] = op(p[i - 1], p[i]);
+                });
+            return;
+        }
+    }
+
+    for (std::size_t i = 1; i < n; ++i)
+        p[i] = op(p[i - 1], p[i]);
+}
+
+template<class T, class BinaryOp>
+constexpr void exclusive_scan_n(T* p, std::size_t n, T init, BinaryOp& op) {
+    if (!std::is_constant_evaluated()) {
+        if (std::size_t workers = scan_workers(n); workers > 1) {
+            blocked_scan<T>(n, workers, std::move(init),
+                [&](std::size_t lo, std::size_t hi) {
+                    T acc = p[lo];
+                    for (std::size_t i = lo + 1; i < hi; ++i)
+                        acc = op(std::move(acc), p[i]);
+                    return acc;
+                },
+                op,
+                [&](std::size_t lo, std::size_t hi, const std::optional<T>& carry) {
+                    T acc = *carry;
+                    for (std::size_t i = lo; i < hi; ++i) {
+                        T next = op(acc, p[i]);
+                        p[i] = std::move(acc);
+                        acc = std::move(next);
+                    }
+                });
+            return;
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        T next = op(init, p[i]);
+        p[i] = std::move(init);
+        init = std::move(next);
+    }
+}
+
+}  // namespace detail
+
+// Replaces v[i] with v[0] op v[1] op ... op v[i].
+// `op` must be associative, but need not be commutative.
+template<Vector Vec, class BinaryOp = std::plus<>>
+constexpr void inclusive_scan(Vec& v, BinaryOp op = {}) {
+    detail::inclusive_scan_n(v.data(), v.size(), op);
+}
+
+// Replaces v[i] with init op v[0] op ... op v[i - 1], so v[0] becomes init.
+// `op` must be associative, but need not be commutative.
+template<Vector Vec, class BinaryOp = std::plus<>>
+constexpr void exclusive_scan(Vec& v, typename Vec::value_type init, BinaryOp op = {}) {
+    detail::exclusive_scan_n(v.data(), v.size(), std::move(init), op);
+}
+
+// Inclusive scan that restarts wherever heads[i] is true, i.e. every segment
+// [i, j) between two heads is scanned independently. Position 0 always starts
+// a segment. `heads` can be any indexable container of size v.size().
+template<Vector Vec, class Flags, class BinaryOp = std::plus<>>
+constexpr void segmented_inclusive_scan(Vec& v, const Flags& heads, BinaryOp op = {}) {
+    using T = typename Vec::value_type;
+    auto* p = v.data();
+    std::size_t n = v.size();
+    if (std::size(heads) != n)
+        throw std::invalid_argument("Segment flags must match vector size.");
+
+    if (!std::is_constant_evaluated()) {
+        if (std::size_t workers = detail::scan_workers(n); workers > 1) {
+            // Summary of a block: whether it contains a head, and the combined
+            // value of its trailing (still open) segment.
+            using S = std::pair<bool, T>;
+            detail::blocked_scan<S>(n, workers, std::nullopt,
+                [&](std::size_t lo, std::size_t hi) {
+                    std::size_t first = hi;
+                    while (first > lo && !heads[first - 1])
+                        --first;
+                    bool has_head = first > lo;
+                    if (has_head)
+                        --first;
+                    else
+                        first = lo;
+                    T acc = p[first];
+                    for (std::size_t i = first + 1; i < hi; ++i)
+                        acc = op(std::move(acc), p[i]);
+                    return S(has_head, std::move(acc));
+                },
+                [&](const S& a, const S& b) {
+                    return b.first ? b : S(a.first, op(a.second, b.second));
+                },
+                [&](std::size_t lo, std::size_t hi, const std::optional<S>& carry) {
+                    if (carry && !heads[lo])
+                        p[lo] = op(carry->second, p[lo]);
+                    for (std::size_t i = lo + 1; i < hi; ++i)
+                        if (!heads[i])
+                            p[i] = op(p[i - 1], p[i]);
+                });
+            return;
+        }
+    }
+
+    for (std::size_t i = 1; i < n; ++i)
+        if (!heads[i])
+            p[i] = op(p[i - 1], p[i]);
+}
+
+namespace detail {
+
+// FixedCapacityVector overloads fully unroll over the capacity up to this bound.
+inline constexpr std::size_t unroll_limit = 32;
+
+// FixedCapacityVector overloads put scratch buffers of up to this many bytes on the stack.
+inline constexpr std::size_t stack_scratch_limit = 16 * 1024;
+
+// Calls f(std::integral_constant<std::size_t, I>) for I = 0, 1, ..., N - 1 as
+// an unrolled sequence, stopping early once f returns false.
+template<std::size_t N, class F>
+constexpr void static_for(F&& f) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (void)(f(std::integral_constant<std::size_t, I>{}) && ...);
+    }(std::make_index_sequence<N>{});
+}
+
+// Batcher's odd-even merge sort network on bit_ceil(N) wires, with the
+// comparators touching wires >= N dropped. Dropping them is equivalent to
+// padding the input with +infinity, so the result still sorts N wires, and by
+// the same argument it sorts any prefix of n <= N wires once comparators
+// touching wires >= n are skipped as well.
+template<std::size_t N, class Emit>
+constexpr void batcher_pairs(Emit emit) {
+    std::size_t wires = std::bit_ceil(N);
+    for (std::size_t p = 1; p < wires; p <<= 1)
+        for (std::size_t k = p; k >= 1; k >>= 1)
+            for (std::size_t j = k % p; j + k < wires; j += 2 * k)
+                for (std::size_t i = 0; i < std::min(k, wires - j - k); ++i)
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p) && i + j + k < N)
+                        emit(i + j, i + j + k);
+}
+
+template<std::size_t N>
+constexpr std::size_t batcher_size() {
+    std::size_t count = 0;
+    batcher_pairs<N>([&](std::size_t, std::size_t) { ++count; });
+    return count;
+}
+
+template<std::size_t N>
+inline constexpr auto sorting_network = [] {
+    std::array<std::pair<std::size_t, std::size_t>, batcher_size<N>()> net{};
+    std::size_t count = 0;
+    batcher_pairs<N>([&](std::size_t a, std::size_t b) { net[count++] = {a, b}; });
+    return net;
+}();
+
+template<class T, class Compare>
+constexpr void compare_exchange(T& a, T& b, Compare& comp) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        // Branchless, so the compiler can use conditional moves
+        T x = a, y = b;
+        bool swap = comp(y, x);
+        a = swap ? y : x;
+        b = swap ? x : y;
+    } else if (comp(b, a)) {
+        std::swap(a, b);
+    }
+}
+
+// Size-optimal sorting networks for exactly N wires, N <= 8 (Knuth, TAOCP
+// vol. 3, 5.3.4). Empty for larger N.
+template<std::size_t N>
+constexpr auto make_optimal_network() {
+    using Pair = std::pair<std::size_t, std::size_t>;
+    if constexpr (N == 2)
+        return std::array<Pair, 1>{{{0, 1}}};
+    else if constexpr (N == 3)
+        return std::array<Pair, 3>{{{0, 2}, {0, 1}, {1, 2}}};
+    else if constexpr (N == 4)
+        return std::array<Pair, 5>{{{0, 2}, {1, 3}, {0, 1}, {2, 3}, {1, 2}}};
+    else if constexpr (N == 5)
+        return std::array<Pair, 9>{{{0, 3}, {1, 4}, {0, 2}, {1, 3}, {0, 1}, {2, 4}, {1, 2}, {3, 4},
+                                    {2, 3}}};
+    else if constexpr (N == 6)
+        return std::array<Pair, 12>{{{0, 5}, {1, 3}, {2, 4}, {1, 2}, {3, 4}, {0, 3}, {2, 5}, {0, 1},
+                                     {2, 3}, {4, 5}, {1, 2}, {3, 4}}};
+    else if constexpr (N == 7)
+        return std::array<Pair, 16>{{{0, 6}, {2, 3}, {4, 5}, {0, 2}, {1, 4}, {3, 6}, {0, 1}, {2, 5},
+                                     {3, 4}, {1, 2}, {4, 6}, {2, 3}, {4, 5}, {1, 2}, {3, 4}, {5, 6}}};
+    else if constexpr (N == 8)
+        return std::array<Pair, 19>{{{0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7},
+                                     {0, 1}, {2, 3}, {4, 5}, {6, 7}, {2, 4}, {3, 5}, {1, 4}, {3, 6},
+                                     {1, 2}, {3, 4}, {5, 6}}};
+    else
+        return std::array<Pair, 0>{};
+}
+
+inline constexpr std::size_t optimal_network_limit = 8;
+
+template<std::size_t N>
+inline constexpr auto optimal_network = make_optimal_network<N>();
+
+// Applies the comparators of Net to [p, p + n), skipping those that touch
+// wires >= n (see batcher_pairs for why that still sorts).
+template<const auto& Net, class T, class Compare>
+constexpr void apply_network(T* p, std::size_t n, Compare& comp) {
+    static_for<Net.size()>([&](auto c) {
+        constexpr std::size_t a = Net[c].first;
+        constexpr std::size_t b = Net[c].second;
+        if (b < n)
+            compare_exchange(p[a], p[b], comp);
+        return true;
+    });
+}
+
+// Sorts [p, p + n) for n <= N with sorting_network<N>.
+template<std::size_t N, class T, class Compare>
+constexpr void network_sort(T* p, std::size_t n, Compare& comp) {
+    apply_network<sorting_network<N>>(p, n, comp);
+}
+
+// Sorts [p, p + n) for n <= N <= optimal_network_limit with the optimal
+// network for exactly n wires.
+template<std::size_t N, class T, class Compare>
+constexpr void optimal_network_sort(T* p, std::size_t n, Compare& comp) {
+    static_for<N + 1>([&](auto k) {
+        if (k != n)
+            return true;
+        apply_network<optimal_network<decltype(k)::value>>(p, k, comp);
+        return false;
+    });
+}
+
+// LSD radix sort applies to integral keys compared with std::less.
+template<class T, class Compare>
+concept radix_sortable = std::integral<T> && !std::same_as<T, bool>
+                      && (std::same_as<Compare, std::less<>> || std::same_as<Compare, std::less<T>>);
+
+// Below this many elements introsort beats the 256-bucket passes.
+inline constexpr std::size_t radix_threshold = 128;
+
+// LSD radix sort of [p, p + n) one byte at a time, using tmp[0, n) as
+// scratch. Stable. Passes where every key has the same byte are skipped.
+//
+// Keys are read as unsigned with the sign bit flipped, which preserves order.
+// The digit is computed inline rather than through a helper, since every call
+// is interpreted separately during constant evaluation.
+template<std::integral T>
+constexpr void radix_sort(T* p, std::size_t n, T* tmp) {
+    using U = std::make_unsigned_t<T>;
+    constexpr U flip = std::is_signed_v<T> ? U(U(1) << (sizeof(T) * 8 - 1)) : U(0);
+    if (n < 2)
+        return;
+    T* src = p;
+    T* dst = tmp;
+    for (std::size_t shift = 0; shift < sizeof(T) * 8; shift += 8) {
+        std::array<std::size_t, 256> offsets{};
+        for (std::size_t i = 0; i < n; ++i)
+            ++offsets[(U(src[i] ^ flip) >> shift) & 0xff];
+        if (offsets[(U(src[0] ^ flip) >> shift) & 0xff] == n)
+            continue;
+        std::size_t sum = 0;
+        for (std::size_t& offset : offsets)
+            sum += std::exchange(offset, sum);
+        for (std::size_t i = 0; i < n; ++i)
+            dst[offsets[(U(src[i] ^ flip) >> shift) & 0xff]++] = src[i];
+        std::swap(src, dst);
+    }
+    if (src != p)
+        std::copy(src, src + n, p);
+}
+
+// Bottom-up merge sort of [p, p + n) using tmp[0, n) as scratch. Stable.
+template<class T, class Compare>
+constexpr void merge_sort(T* p, std::size_t n, T* tmp, Compare& comp) {
+    T* src = p;
+    T* dst = tmp;
+    for (std::size_t width = 1; width < n; width *= 2) {
+        for (std::size_t lo = 0; lo < n; lo += 2 * width) {
+            std::size_t mid = std::min(lo + width, n);
+            std::size_t hi = std::min(lo + 2 * width, n);
+            std::merge(std::make_move_iterator(src + lo), std::make_move_iterator(src + mid),
+                       std::make_move_iterator(src + mid), std::make_move_iterator(src + hi),
+                       dst + lo, comp);
+        }
+        std::swap(src, dst);
+    }
+    if (src != p)
+        std::move(src, src + n, p);
+}
+
+}  // namespace detail
+
+// Capacity-aware overloads
+//
+// Each algorithm below has a Vector overload and a FixedCapacityVector
+// overload. The latter is picked automatically for a MyVec and uses the
+// compile-time capacity N: fully unrolled code when N <= detail::unroll_limit,
+// and stack scratch buffers instead of heap ones.
+
+template<FixedCapacityVector Vec, class BinaryOp = std::plus<>>
+constexpr void inclusive_scan(Vec& v, BinaryOp op = {}) {
+    constexpr std::size_t N = Vec::static_capacity;
+    auto* p = v.data();
+    std::size_t n = v.size();
+    if constexpr (N <= detail::unroll_limit) {
+        detail::static_for<N>([&](auto i) {
+            if (i >= n)
+                return false;
+            if constexpr (i > 0)
+                p[i] = op(p[i - 1], p[i]);
+            return true;
+        });
+    } else {
+        detail::inclusive_scan_n(p, n, op);
+    }
+}
+
+template<FixedCapacityVector Vec, class BinaryOp = std::plus<>>
+constexpr void exclusive_scan(Vec& v, typename Vec::value_type init, BinaryOp op = {}) {
+    constexpr std::size_t N = Vec::static_capacity;
+    auto* p = v.data();
+    std::size_t n = v.size();
+    if constexpr (N <= detail::unroll_limit) {
+        detail::static_for<N>([&](auto i) {
+            if (i >= n)
+                return false;
+            auto next = op(init, p[i]);
+            p[i] = std::move(init);
+            init = std::move(next);
+            return true;
+        });
+    } else {
+        detail::exclusive_scan_n(p, n, std::move(init), op);
+    }
+}
+
+// Returns init op v[0] op ... op v[size - 1]. `op` must be associative.
+template<Vector Vec, class T, class BinaryOp = std::plus<>>
+constexpr T reduce(const Vec& v, T init, BinaryOp op = {}) {
+    for (const auto& elem : v)
+        init = op(std::move(init), elem);
+    return init;
+}
+
+template<FixedCapacityVector Vec, class T, class BinaryOp = std::plus<>>
+constexpr T reduce(const Vec& v, T init, BinaryOp op = {}) {
+    constexpr std::size_t N = Vec::static_capacity;
+    const auto* p = v.data();
+    std::size_t n = v.size();
+    if constexpr (N <= detail::unroll_limit) {
+        detail::static_for<N>([&](auto i) {
+            if (i >= n)
+                return false;
+            init = op(std::move(init), p[i]);
+            return true;
+        });
+    } else {
+        for (std::size_t i = 0; i < n; ++i)
+            init = op(std::move(init), p[i]);
+    }
+    return init;
+}
+
+// Sorts v with respect to comp. Not stable.
+template<Vector Vec, class Compare = std::less<>>
+constexpr void sort(Vec& v, Compare comp = {}) {
+    std::sort(v.begin(), v.end(), comp);
+}
+
+// Picks the algorithm from the capacity and element type:
+// - N <= 8: the size-optimal network for the current size
+// - N <= 32: an unrolled Batcher network
+// - integral T with std::less: LSD radix sort, scratch on the stack if it fits
+// - otherwise: std::sort (introsort)
+// All of these work in constant evaluation.
+template<FixedCapacityVector Vec, class Compare = std::less<>>
+constexpr void sort(Vec& v, Compare comp = {}) {
+    using T = typename Vec::value_type;
+    constexpr std::size_t N = Vec::static_capacity;
+    auto* p = v.data();
+    std::size_t n = v.size();
+    if constexpr (N <= detail::optimal_network_limit) {
+        detail::optimal_network_sort<N>(p, n, comp);
+    } else if constexpr (N <= detail::unroll_limit) {
+        detail::network_sort<N>(p, n, comp);
+    } else if constexpr (detail::radix_sortable<T, Compare>) {
+        if (n < detail::radix_threshold) {
+            std::sort(v.begin(), v.end(), comp);
+        } else if constexpr (N * sizeof(T) <= detail::stack_scratch_limit) {
+            std::array<T, N> tmp{};
+            detail::radix_sort(p, n, tmp.data());
+        } else {
+            std::vector<T> tmp(n);
+            detail::radix_sort(p, n, tmp.data());
+        }
+    } else {
+        std::sort(v.begin(), v.end(), comp);
+    }
+}
+
+// Sorts v with respect to comp, keeping equivalent elements in order.
+// std::stable_sort is not constexpr, so constant evaluation merge sorts
+// through a transient std::vector instead.
+template<Vector Vec, class Compare = std::less<>>
+constexpr void stable_sort(Vec& v, Compare comp = {}) {
+    if (std::is_constant_evaluated()) {
+        std::vector<typename Vec::value_type> tmp(v.size());
+        detail::merge_sort(v.data(), v.size(), tmp.data(), comp);
+    } else {
+        std::stable_sort(v.begin(), v.end(), comp);
+    }
+}
+
+// Merge sorts through a stack buffer of the full capacity when it is small
+// enough, so nothing is allocated.
+template<FixedCapacityVector Vec, class Compare = std::less<>>
+constexpr void stable_sort(Vec& v, Compare comp = {}) {
+    using T = typename Vec::value_type;
+    constexpr std::size_t N = Vec::static_capacity;
+    if constexpr (N * sizeof(T) <= detail::stack_scratch_limit && std::is_default_constructible_v<T>) {
+        std::array<T, N> tmp{};
+        detail::merge_sort(v.data(), v.size(), tmp.data(), comp);
+    } else if (std::is_constant_evaluated()) {
+        std::vector<T> tmp(v.size());
+        detail::merge_sort(v.data(), v.size(), tmp.data(), comp);
+    } else {
+        std::stable_sort(v.begin(), v.end(), comp);
+    }
+}
+
+// Returns the first position in the sorted v whose element is not less than value.
+template<Vector Vec, class T, class Compare = std::less<>>
+constexpr typename Vec::const_iterator lower_bound(const Vec& v, const T& value, Compare comp = {}) {
+    return std::lower_bound(v.begin(), v.end(), value, comp);
+}
+
+// Branchless binary search, unrolled to the bit_width(N) halvings the
+// capacity allows.
+template<FixedCapacityVector Vec, class T, class Compare = std::less<>>
+constexpr typename Vec::const_iterator lower_bound(const Vec& v, const T& value, Compare comp = {}) {
+    constexpr std::size_t N = Vec::static_capacity;
+    const auto* base = v.data();
+    std::size_t len = v.size();
+    if (len == 0)
+        return v.begin();
+    detail::static_for<std::bit_width(N)>([&](auto) {
+        if (len <= 1)
+            return false;
+        std::size_t half = len / 2;
+        base = comp(base[half - 1], value) ? base + half : base;
+        len -= half;
+        return true;
+    });
+    return v.begin() + (base - v.data()) + bool(comp(*base, value));
+}
+
+// std::span overloads
+//
+// Views from MyVec::first<K>(), subspan<O, K>() or chunks<K>() keep their
+// extent in the type, so small static extents get the same unrolled code as
+// small capacities, without the size checks.
+
+template<class T, std::size_t Extent, class BinaryOp = std::plus<>>
+constexpr void inclusive_scan(std::span<T, Extent> s, BinaryOp op = {}) {
+    if constexpr (Extent != std::dynamic_extent && Extent <= detail::unroll_limit) {
+        detail::static_for<Extent>([&](auto i) {
+            if constexpr (i > 0)
+                s[i] = op(s[i - 1], s[i]);
+            return true;
+        });
+    } else {
+        detail::inclusive_scan_n(s.data(), s.size(), op);
+    }
+}
+
+template<class T, std::size_t Extent, class BinaryOp = std::plus<>>
+constexpr void exclusive_scan(std::span<T, Extent> s, std::type_identity_t<T> init, BinaryOp op = {}) {
+    if constexpr (Extent != std::dynamic_extent && Extent <= detail::unroll_limit) {
+        detail::static_for<Extent>([&](auto i) {
+            T next = op(init, s[i]);
+            s[i] = std::move(init);
+            init = std::move(next);
+            return true;
+        });
+    } else {
+        detail::exclusive_scan_n(s.data(), s.size(), std::move(init), op);
+    }
+}
+
+template<class T, std::size_t Extent, class U, class BinaryOp = std::plus<>>
+constexpr U reduce(std::span<T, Extent> s, U init, BinaryOp op = {}) {
+    if constexpr (Extent != std::dynamic_extent && Extent <= detail::unroll_limit) {
+        detail::static_for<Extent>([&](auto i) {
+            init = op(std::move(init), s[i]);
+            return true;
+        });
+    } else {
+        for (const auto& elem : s)
+            init = op(std::move(init), elem);
+    }
+    return init;
+}
+
+template<class T, std::size_t Extent, class Compare = std::less<>>
+constexpr void sort(std::span<T, Extent> s, Compare comp = {}) {
+    if constexpr (Extent != std::dynamic_extent && Extent <= detail::optimal_network_limit)
+        detail::apply_network<detail::optimal_network<Extent>>(s.data(), Extent, comp);
+    else if constexpr (Extent != std::dynamic_extent && Extent <= detail::unroll_limit)
+        detail::network_sort<Extent>(s.data(), Extent, comp);
+    else
+        std::sort(s.begin(), s.end(), comp);
+}
+
+#endif // VEC_ALGORITHMS_H
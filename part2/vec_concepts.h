@@ -1,6 +1,17 @@
 #ifndef VEC_CONCEPTS_H
 #define VEC_CONCEPTS_H
 
+#include "my_vector.h"
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 template<class T>
 struct is_vector : std::false_type {};
 
@@ -160,4 +171,13 @@ concept Vector = requires(
     { std::swap(a, b) } -> std::same_as<void>;
 };
 
+// Vector whose capacity is a compile-time constant, e.g. MyVec<T, N>.
+// Algorithms can overload on this to unroll loops over the known bound or
+// size scratch buffers on the stack instead of the heap.
+template<class Vec>
+concept FixedCapacityVector = Vector<Vec> && requires {
+    { Vec::static_capacity } -> std::convertible_to<std::size_t>;
+    typename std::integral_constant<std::size_t, Vec::static_capacity>;
+};
+
 #endif // VEC_CONCEPTS_H
\ No newline at end of file
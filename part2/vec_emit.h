@@ -0,0 +1,214 @@
+#ifndef VEC_EMIT_H
+#define VEC_EMIT_H
+
+#include "my_vector.h"
+
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+// Writes a table computed at runtime out as C++ source, so that the next build
+// embeds it as a constexpr object instead of computing it again at startup:
+//
+//     MyVec<double, 4096> table = expensive();            // offline, once
+//     write_constexpr_table("table.h", "table", table);
+//
+//     #include "table.h"                                  // next build
+//     static_assert(table.size() == 4096);
+//
+// A MyVec<T, N> is emitted as a MyVec<T, N> and a std::vector<T> as a
+// std::array<T, size>, like the dataset codegen.py writes. Next to the table
+// goes a static_assert that its vec_content_hash is the one computed when it
+// was written, so a table edited or truncated by hand stops compiling.
+// Elements must be arithmetic types with an emit_type_name. Floating point
+// values are written in their shortest round-trip form, so the emitted table
+// is bit-identical. long double is left out: its padding bytes would make
+// vec_content_hash differ between runtime and constant evaluation.
+
+// Spelling of T in the emitted source, empty for types that cannot be emitted
+template<class T> inline constexpr std::string_view emit_type_name = {};
+template<> inline constexpr std::string_view emit_type_name<bool> = "bool";
+template<> inline constexpr std::string_view emit_type_name<char> = "char";
+template<> inline constexpr std::string_view emit_type_name<wchar_t> = "wchar_t";
+template<> inline constexpr std::string_view emit_type_name<char8_t> = "char8_t";
+template<> inline constexpr std::string_view emit_type_name<char16_t> = "char16_t";
+template<> inline constexpr std::string_view emit_type_name<char32_t> = "char32_t";
+template<> inline constexpr std::string_view emit_type_name<signed char> = "signed char";
+template<> inline constexpr std::string_view emit_type_name<unsigned char> = "unsigned char";
+template<> inline constexpr std::string_view emit_type_name<short> = "short";
+template<> inline constexpr std::string_view emit_type_name<unsigned short> = "unsigned short";
+template<> inline constexpr std::string_view emit_type_name<int> = "int";
+template<> inline constexpr std::string_view emit_type_name<unsigned> = "unsigned";
+template<> inline constexpr std::string_view emit_type_name<long> = "long";
+template<> inline constexpr std::string_view emit_type_name<unsigned long> = "unsigned long";
+template<> inline constexpr std::string_view emit_type_name<long long> = "long long";
+template<> inline constexpr std::string_view emit_type_name<unsigned long long> = "unsigned long long";
+template<> inline constexpr std::string_view emit_type_name<float> = "float";
+template<> inline constexpr std::string_view emit_type_name<double> = "double";
+
+template<class T>
+concept Emittable = std::is_arithmetic_v<T> && !emit_type_name<T>.empty();
+
+// FNV-1a over the object representation of every element, in order. Gives
+// the same value at runtime and in constant evaluation.
+template<class Vec>
+constexpr std::uint64_t vec_content_hash(const Vec& v) {
+    using T = typename Vec::value_type;
+    std::uint64_t h = 0xcbf29ce484222325;
+    for (const T& x : v) {
+        auto bytes = std::bit_cast<std::array<unsigned char, sizeof(T)>>(x);
+        for (unsigned char b : bytes)
+            h = (h ^ b) * 0x100000001b3;
+    }
+    return h;
+}
+
+namespace detail {
+
+template<class T>
+inline constexpr bool is_my_vec = false;
+
+template<class T, std::size_t N>
+inline constexpr bool is_my_vec<MyVec<T, N>> = true;
+
+// Prefix of the character literals of T, e.g. u8 for u8'\x41'
+template<class T>
+inline constexpr std::string_view char_literal_prefix = {};
+template<> inline constexpr std::string_view char_literal_prefix<wchar_t> = "L";
+template<> inline constexpr std::string_view char_literal_prefix<char8_t> = "u8";
+template<> inline constexpr std::string_view char_literal_prefix<char16_t> = "u";
+template<> inline constexpr std::string_view char_literal_prefix<char32_t> = "U";
+
+// Appends x as a literal of type T
+template<Emittable T>
+void append_literal(std::string& out, T x) {
+    if constexpr (std::is_same_v<T, bool>) {
+        out += x ? "true" : "false";
+    } else if constexpr (!char_literal_prefix<T>.empty()) {
+        // A hex escape gives any code unit, valid character or not
+        char buf[32];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), std::make_unsigned_t<T>(x), 16);
+        out += char_literal_prefix<T>;
+        out += "'\\x";
+        out.append(buf, end);
+        out += '\'';
+    } else if constexpr (std::is_floating_point_v<T>) {
+        std::string_view type = emit_type_name<T>;
+        if (std::isnan(x))
+            throw std::domain_error("NaN cannot be emitted as a constant.");
+        if (std::isinf(x)) {
+            out += x < 0 ? "-" : "";
+            out += "std::numeric_limits<" + std::string(type) + ">::infinity()";
+            return;
+        }
+        char buf[64];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), x);
+        std::string_view digits(buf, end - buf);
+        out += digits;
+        // Keep integral-looking values floating point, e.g. 1 -> 1.0
+        if (digits.find_first_of(".e") == std::string_view::npos)
+            out += ".0";
+        if constexpr (std::is_same_v<T, float>)
+            out += 'f';
+    } else if constexpr (std::is_signed_v<T>) {
+        // The most negative value has no literal: -9223372036854775808 is the
+        // negation of an out-of-range literal
+        if (x == std::numeric_limits<T>::min() && sizeof(T) >= sizeof(int)) {
+            append_literal<T>(out, T(x + 1));
+            out += " - 1";
+            return;
+        }
+        char buf[32];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), x);
+        out.append(buf, end);
+        if constexpr (sizeof(T) > sizeof(int))
+            out += "LL";
+    } else {
+        char buf[32];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), x);
+        out.append(buf, end);
+        if constexpr (sizeof(T) >= sizeof(int))
+            out += sizeof(T) > sizeof(unsigned) ? "ULL" : "U";
+    }
+}
+
+}  // namespace detail
+
+// Writes the definition of `v` as `inline constexpr ... name`, followed by the
+// static_assert checking its hash. The source needs my_vector.h (for MyVec),
+// <array> and <limits> (for infinities) and vec_emit.h in scope.
+template<class Vec>
+requires Emittable<typename Vec::value_type>
+void emit_constexpr_table(std::ostream& os, std::string_view name, const Vec& v) {
+    using T = typename Vec::value_type;
+    static_assert(detail::is_my_vec<Vec> || std::is_same_v<Vec, std::vector<T>>,
+                  "Only MyVec and std::vector tables can be emitted.");
+
+    std::string type = std::string(emit_type_name<T>);
+    std::string out = "inline constexpr ";
+    if constexpr (detail::is_my_vec<Vec>)
+        out += "MyVec<" + type + ", " + std::to_string(Vec::static_capacity) + "> ";
+    else
+        out += "std::array<" + type + ", " + std::to_string(v.size()) + "> ";
+    out += name;
+    out += detail::is_my_vec<Vec> ? " = {\n" : " = {{\n";
+
+    // As many elements per line as fit in 100 columns
+    std::string line = "   ";
+    for (const T& x : v) {
+        std::string literal;
+        detail::append_literal(literal, x);
+        if (line.size() + literal.size() + 2 > 100) {
+            out += line + '\n';
+            line = "   ";
+        }
+        line += ' ' + literal + ',';
+    }
+    if (!v.empty())
+        out += line + '\n';
+    out += detail::is_my_vec<Vec> ? "};\n" : "}};\n";
+
+    char hash[32];
+    auto [end, ec] = std::to_chars(hash, hash + sizeof(hash), vec_content_hash(v), 16);
+    out += "static_assert(vec_content_hash(" + std::string(name) + ") == 0x" + std::string(hash, end) + "ULL,\n"
+           "              \"" + std::string(name) + " differs from the table that was emitted\");\n";
+    os << out;
+}
+
+// Writes a header holding only the table `name`, with an include guard and
+// the includes it needs. vec_emit.h must be on the include path.
+template<class Vec>
+requires Emittable<typename Vec::value_type>
+void write_constexpr_table(const std::string& path, std::string_view name, const Vec& v) {
+    std::string guard;
+    for (char c : name)
+        guard += (c >= 'a' && c <= 'z') ? char(c - 'a' + 'A') : c;
+    guard += "_TABLE_H";
+
+    std::ofstream out(path, std::ios::trunc);
+    out << "// This file was generated by write_constexpr_table.\n"
+        << "// Do not modify it manually; regenerate it instead.\n\n"
+        << "#ifndef " << guard << "\n#define " << guard << "\n\n"
+        << "#include \"vec_emit.h\"\n\n"
+        << "#include <array>\n#include <limits>\n\n";
+    emit_constexpr_table(out, name, v);
+    out << "\n#endif  // " << guard << "\n";
+    out.close();
+    if (!out)
+        throw std::system_error(errno, std::generic_category(), path);
+}
+
+#endif // VEC_EMIT_H
@@ -0,0 +1,184 @@
+#ifndef VEC_EXPR_H
+#define VEC_EXPR_H
+
+#include "my_vector.h"
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "vec_concepts.h"
+
+// Lazy element-wise arithmetic.
+//
+// `a + b * c - d` over MyVecs builds a small expression object instead of a
+// temporary MyVec per operator. Nothing is computed until the expression is
+// converted to a Vector, at which point the whole expression is evaluated in
+// a single loop:
+//
+//     MyVec<double, N> r = a + b * c - d;
+//     MyVec<double, N> s = 2.0 * a - 1.0;
+//
+// The operators apply when either side is a MyVec (or any FixedCapacityVector)
+// or an expression. Any other contiguous Vector, e.g. a std::vector, joins in
+// through vec_expr(v):
+//
+//     std::vector<double> r = vec_expr(a) + vec_expr(b) * c;
+//
+// Expressions refer to their vector operands rather than copying them, so they
+// must be evaluated before the operands go out of scope.
+
+template<class E>
+concept VecExpression = requires(const E& e, std::size_t i) {
+    typename E::vec_expr_tag;
+    e[i];
+    { e.size() } -> std::same_as<std::size_t>;
+};
+
+template<class Derived>
+struct VecExprBase {
+    using vec_expr_tag = void;
+
+    // Evaluates the expression into `out`, resizing it to size().
+    template<Vector Vec>
+    constexpr void evaluate_into(Vec& out) const {
+        const Derived& self = static_cast<const Derived&>(*this);
+        std::size_t n = self.size();
+        out.resize(n);
+        auto* dst = out.data();
+        for (std::size_t i = 0; i < n; ++i)
+            dst[i] = self[i];
+    }
+
+    template<Vector Vec>
+    constexpr operator Vec() const {
+        Vec out;
+        evaluate_into(out);
+        return out;
+    }
+};
+
+// Leaf referring to the elements of a contiguous Vector.
+template<class T>
+class VecRef : public VecExprBase<VecRef<T>> {
+public:
+    static constexpr bool is_scalar = false;
+
+    constexpr VecRef(const T* data, std::size_t size) noexcept : ptr(data), sz(size) {}
+
+    constexpr const T& operator[](std::size_t i) const { return ptr[i]; }
+    constexpr std::size_t size() const noexcept { return sz; }
+
+private:
+    const T* ptr;
+    std::size_t sz;
+};
+
+// Leaf broadcasting a single value to every position.
+template<class T>
+class VecScalar : public VecExprBase<VecScalar<T>> {
+public:
+    static constexpr bool is_scalar = true;
+
+    constexpr explicit VecScalar(T value) : value(std::move(value)) {}
+
+    constexpr const T& operator[](std::size_t) const { return value; }
+    constexpr std::size_t size() const noexcept { return 0; }
+
+private:
+    T value;
+};
+
+template<class Op, class E>
+class VecUnaryExpr : public VecExprBase<VecUnaryExpr<Op, E>> {
+public:
+    static constexpr bool is_scalar = E::is_scalar;
+
+    constexpr explicit VecUnaryExpr(E e) : e(std::move(e)) {}
+
+    constexpr auto operator[](std::size_t i) const { return Op()(e[i]); }
+    constexpr std::size_t size() const noexcept { return e.size(); }
+
+private:
+    E e;
+};
+
+template<class Op, class L, class R>
+class VecBinaryExpr : public VecExprBase<VecBinaryExpr<Op, L, R>> {
+public:
+    static constexpr bool is_scalar = L::is_scalar && R::is_scalar;
+
+    constexpr VecBinaryExpr(L l, R r) : l(std::move(l)), r(std::move(r)) {
+        if (!L::is_scalar && !R::is_scalar && this->l.size() != this->r.size())
+            throw std::invalid_argument("Operand sizes must match.");
+    }
+
+    constexpr auto operator[](std::size_t i) const { return Op()(l[i], r[i]); }
+    constexpr std::size_t size() const noexcept { return L::is_scalar ? r.size() : l.size(); }
+
+private:
+    L l;
+    R r;
+};
+
+// Wraps a contiguous Vector so it can take part in an expression.
+template<Vector Vec>
+constexpr VecRef<typename Vec::value_type> vec_expr(const Vec& v) noexcept {
+    return VecRef<typename Vec::value_type>(v.data(), v.size());
+}
+
+namespace detail {
+
+template<class T>
+concept expr_operand = VecExpression<std::remove_cvref_t<T>>
+                    || Vector<std::remove_cvref_t<T>>
+                    || std::is_arithmetic_v<std::remove_cvref_t<T>>;
+
+// At least one side must be an expression or a fixed-capacity vector, so that
+// e.g. std::vector + std::vector is left alone.
+template<class L, class R>
+concept expr_operands = expr_operand<L> && expr_operand<R>
+    && (VecExpression<std::remove_cvref_t<L>> || FixedCapacityVector<std::remove_cvref_t<L>>
+     || VecExpression<std::remove_cvref_t<R>> || FixedCapacityVector<std::remove_cvref_t<R>>);
+
+template<class T>
+constexpr auto as_expr(const T& x) {
+    if constexpr (VecExpression<T>)
+        return x;
+    else if constexpr (Vector<T>)
+        return vec_expr(x);
+    else
+        return VecScalar<T>(x);
+}
+
+template<class Op, class L, class R>
+constexpr auto make_binary(const L& l, const R& r) {
+    auto le = as_expr(l);
+    auto re = as_expr(r);
+    return VecBinaryExpr<Op, decltype(le), decltype(re)>(std::move(le), std::move(re));
+}
+
+}  // namespace detail
+
+template<class L, class R> requires detail::expr_operands<L, R>
+constexpr auto operator+(const L& l, const R& r) { return detail::make_binary<std::plus<>>(l, r); }
+
+template<class L, class R> requires detail::expr_operands<L, R>
+constexpr auto operator-(const L& l, const R& r) { return detail::make_binary<std::minus<>>(l, r); }
+
+template<class L, class R> requires detail::expr_operands<L, R>
+constexpr auto operator*(const L& l, const R& r) { return detail::make_binary<std::multiplies<>>(l, r); }
+
+template<class L, class R> requires detail::expr_operands<L, R>
+constexpr auto operator/(const L& l, const R& r) { return detail::make_binary<std::divides<>>(l, r); }
+
+template<class E> requires VecExpression<E> || FixedCapacityVector<E>
+constexpr auto operator-(const E& e) {
+    auto ee = detail::as_expr(e);
+    return VecUnaryExpr<std::negate<>, decltype(ee)>(std::move(ee));
+}
+
+#endif // VEC_EXPR_H
@@ -0,0 +1,126 @@
+#ifndef VEC_RANGE_QUERY_H
+#define VEC_RANGE_QUERY_H
+
+#include "my_vector.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+
+// Precomputed indexes answering range queries over [l, r) in O(1).
+//
+// Build them with the consteval make_* functions into a constexpr variable and
+// the whole table is emitted as constant data: no initialization runs at
+// startup, and queries are a couple of loads.
+//
+//     constexpr MyVec<int, 1000> data = ...;
+//     constexpr auto sums = make_prefix_sum_index(data);
+//     constexpr auto mins = make_sparse_table<min_op>(data);
+//     sums.sum(l, r); mins.query(l, r);
+
+struct min_op {
+    template<class T>
+    constexpr const T& operator()(const T& a, const T& b) const { return std::min(a, b); }
+};
+
+struct max_op {
+    template<class T>
+    constexpr const T& operator()(const T& a, const T& b) const { return std::max(a, b); }
+};
+
+// sums[i] holds the sum of the first i elements, so sum(l, r) = sums[r] - sums[l].
+// Requires T to have an inverse for +, i.e. not suitable for min/max.
+template<class T, std::size_t N>
+class PrefixSumIndex {
+public:
+    constexpr PrefixSumIndex(const T* first, std::size_t count) : sums(), sz(count) {
+        _check_length(count);
+        for (std::size_t i = 0; i < count; ++i)
+            sums[i + 1] = sums[i] + first[i];
+    }
+
+    constexpr std::size_t size() const noexcept { return sz; }
+
+    constexpr T sum(std::size_t l, std::size_t r) const {
+        _check_range(l, r);
+        return sums[r] - sums[l];
+    }
+
+private:
+    std::array<T, N + 1> sums;
+    std::size_t sz;
+
+    constexpr void _check_length(std::size_t count) const {
+        if (count > N) throw std::length_error("Cannot exceed preset capacity.");
+    }
+
+    constexpr void _check_range(std::size_t l, std::size_t r) const {
+        if (l > r || r > sz) throw std::out_of_range("Range out of bounds.");
+    }
+};
+
+// table[k][i] holds op over [i, i + 2^k). A query covers [l, r) with the two
+// overlapping power-of-two windows starting at l and ending at r, so Op must
+// be idempotent (min, max, gcd, bitwise and/or), not just associative.
+template<class T, std::size_t N, class Op>
+class SparseTable {
+public:
+    static constexpr std::size_t levels = N == 0 ? 1 : std::bit_width(N);
+
+    constexpr SparseTable(const T* first, std::size_t count, Op op = {}) : table(), sz(count), op(op) {
+        _check_length(count);
+        for (std::size_t i = 0; i < count; ++i)
+            table[0][i] = first[i];
+        for (std::size_t k = 1; k < levels; ++k) {
+            std::size_t half = std::size_t(1) << (k - 1);
+            for (std::size_t i = 0; i + 2 * half <= count; ++i)
+                table[k][i] = op(table[k - 1][i], table[k - 1][i + half]);
+        }
+    }
+
+    constexpr std::size_t size() const noexcept { return sz; }
+
+    // Requires a non-empty range.
+    constexpr T query(std::size_t l, std::size_t r) const {
+        _check_range(l, r);
+        std::size_t k = std::bit_width(r - l) - 1;
+        return op(table[k][l], table[k][r - (std::size_t(1) << k)]);
+    }
+
+private:
+    std::array<std::array<T, N>, levels> table;
+    std::size_t sz;
+    [[no_unique_address]] Op op;
+
+    constexpr void _check_length(std::size_t count) const {
+        if (count > N) throw std::length_error("Cannot exceed preset capacity.");
+    }
+
+    constexpr void _check_range(std::size_t l, std::size_t r) const {
+        if (l >= r || r > sz) throw std::out_of_range("Range out of bounds.");
+    }
+};
+
+template<class T, std::size_t N>
+consteval PrefixSumIndex<T, N> make_prefix_sum_index(const MyVec<T, N>& v) {
+    return PrefixSumIndex<T, N>(v.data(), v.size());
+}
+
+template<class T, std::size_t N>
+consteval PrefixSumIndex<T, N> make_prefix_sum_index(const std::array<T, N>& a) {
+    return PrefixSumIndex<T, N>(a.data(), a.size());
+}
+
+template<class Op, class T, std::size_t N>
+consteval SparseTable<T, N, Op> make_sparse_table(const MyVec<T, N>& v, Op op = {}) {
+    return SparseTable<T, N, Op>(v.data(), v.size(), op);
+}
+
+template<class Op, class T, std::size_t N>
+consteval SparseTable<T, N, Op> make_sparse_table(const std::array<T, N>& a, Op op = {}) {
+    return SparseTable<T, N, Op>(a.data(), a.size(), op);
+}
+
+#endif // VEC_RANGE_QUERY_H
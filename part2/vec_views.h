@@ -0,0 +1,70 @@
+#ifndef VEC_VIEWS_H
+#define VEC_VIEWS_H
+
+#include "my_vector.h"
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+
+#include "vec_concepts.h"
+
+// Splits contiguous elements into consecutive fixed-extent chunks without
+// copying. Each chunk is a std::span<T, K>; elements left over after the last
+// full chunk are available through remainder().
+//
+//     for (std::span<int, 4> chunk : chunks<4>(v))
+//         kernel(chunk);
+//     tail_kernel(chunks<4>(v).remainder());
+template<class T, std::size_t K>
+class ChunkView {
+    static_assert(K > 0, "Chunks must be non-empty.");
+
+public:
+    class iterator {
+    public:
+        using value_type = std::span<T, K>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        constexpr iterator() noexcept = default;
+        constexpr explicit iterator(T* pos) noexcept : pos(pos) {}
+
+        constexpr value_type operator*() const noexcept { return value_type(pos, K); }
+        constexpr iterator& operator++() noexcept { pos += K; return *this; }
+        constexpr iterator operator++(int) noexcept { iterator old = *this; pos += K; return old; }
+        constexpr bool operator==(const iterator&) const noexcept = default;
+
+    private:
+        T* pos = nullptr;
+    };
+
+    constexpr ChunkView(T* data, std::size_t size) noexcept : ptr(data), sz(size) {}
+
+    constexpr iterator begin() const noexcept { return iterator(ptr); }
+    constexpr iterator end() const noexcept { return iterator(ptr + size() * K); }
+    constexpr std::size_t size() const noexcept { return sz / K; }
+    constexpr std::span<T, K> operator[](std::size_t i) const { return std::span<T, K>(ptr + i * K, K); }
+    constexpr std::span<T> remainder() const noexcept { return {ptr + size() * K, sz % K}; }
+
+private:
+    T* ptr;
+    std::size_t sz;
+};
+
+template<std::size_t K, Vector Vec>
+constexpr ChunkView<typename Vec::value_type, K> chunks(Vec& v) noexcept {
+    return {v.data(), v.size()};
+}
+
+template<std::size_t K, Vector Vec>
+constexpr ChunkView<const typename Vec::value_type, K> chunks(const Vec& v) noexcept {
+    return {v.data(), v.size()};
+}
+
+template<std::size_t K, class T, std::size_t Extent>
+constexpr ChunkView<T, K> chunks(std::span<T, Extent> s) noexcept {
+    return {s.data(), s.size()};
+}
+
+#endif // VEC_VIEWS_H